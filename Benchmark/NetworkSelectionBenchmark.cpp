@@ -0,0 +1,237 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * QTest benchmark of the station selection in the main window.
+ *
+ * A synthetic network of 100 stations (sked catalogs, stations equally distributed on a Fibonacci sphere) is written
+ * to a temporary working directory, which is used as the catalog directory of the main window. Selecting stations one
+ * by one and selecting a whole network at once are timed, the resulting baselines are compared with a full rebuild
+ * of the baseline model. The main window is only driven through its public interface, its slots and the models of
+ * its tree views.
+ *
+ * usage: NetworkSelectionBenchmark [QTest options]
+ */
+
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QTimer>
+#include <QTreeView>
+#include <QtTest>
+#include <cmath>
+#include "../mainwindow.h"
+
+namespace {
+    const double pi = 3.14159265358979323846;
+}
+
+class NetworkSelectionBenchmark : public QObject {
+    Q_OBJECT
+
+   private slots:
+    void initTestCase();
+
+    void cleanupTestCase();
+
+    /**
+     * @brief selects 60 stations one by one as if they were clicked in the list of available stations
+     */
+    void selectOneByOne();
+
+    /**
+     * @brief selects all 100 stations in one call of selectStations, as done when a network is loaded
+     */
+    void selectNetwork();
+
+   private:
+    const int nCatalog_ = 100;  ///< number of stations in the synthetic catalogs
+
+    QTemporaryDir dir_;          ///< working directory with the synthetic catalogs
+    QString previousDir_;        ///< working directory before the test
+    QTimer dialogCloser_;        ///< closes modal dialogs (first start information, ...)
+    MainWindow *window_ = nullptr;
+    QAbstractItemModel *available_ = nullptr;  ///< available stations (proxy model of the tree view)
+    QAbstractItemModel *selected_ = nullptr;   ///< selected stations
+    QAbstractItemModel *baselines_ = nullptr;  ///< selected baselines
+    ChartView *worldmap_ = nullptr;
+    QStringList names_;          ///< station names of the synthetic catalogs
+
+    void writeCatalogs();
+
+    QAbstractItemModel *treeViewModel( const QString &name );
+
+    void createBaselineModel();
+
+    void clearSelection();
+
+    /**
+     * @brief compares the baselines with the ones of a full rebuild of the baseline model
+     */
+    void checkBaselines( int nsta );
+};
+
+void NetworkSelectionBenchmark::initTestCase() {
+    QVERIFY( dir_.isValid() );
+    previousDir_ = QDir::currentPath();
+    QDir::setCurrent( dir_.path() );
+    writeCatalogs();
+
+    connect( &dialogCloser_, &QTimer::timeout, []() {
+        QWidget *modal = QApplication::activeModalWidget();
+        if ( modal != nullptr ) {
+            modal->close();
+        }
+    } );
+    dialogCloser_.start( 100 );
+
+    window_ = new MainWindow();
+    available_ = treeViewModel( "treeView_allAvailabeStations" );
+    selected_ = treeViewModel( "treeView_allSelectedStations" );
+    baselines_ = treeViewModel( "treeView_allSelectedBaselines" );
+    worldmap_ = window_->findChild<ChartView *>( "worldmap" );
+    QVERIFY( available_ != nullptr && selected_ != nullptr && baselines_ != nullptr && worldmap_ != nullptr );
+    QCOMPARE( available_->rowCount(), nCatalog_ );
+}
+
+QAbstractItemModel *NetworkSelectionBenchmark::treeViewModel( const QString &name ) {
+    QTreeView *view = window_->findChild<QTreeView *>( name );
+    return view != nullptr ? view->model() : nullptr;
+}
+
+void NetworkSelectionBenchmark::createBaselineModel() {
+    QVERIFY( QMetaObject::invokeMethod( window_, "createBaselineModel" ) );
+}
+
+void NetworkSelectionBenchmark::cleanupTestCase() {
+    delete window_;
+    dialogCloser_.stop();
+    QDir::setCurrent( previousDir_ );
+}
+
+void NetworkSelectionBenchmark::writeCatalogs() {
+    QDir().mkdir( "AUTO_DOWNLOAD_CATALOGS" );
+    QFile antenna( "AUTO_DOWNLOAD_CATALOGS/antenna.cat" );
+    QFile equip( "AUTO_DOWNLOAD_CATALOGS/equip.cat" );
+    QFile position( "AUTO_DOWNLOAD_CATALOGS/position.cat" );
+    QFile mask( "AUTO_DOWNLOAD_CATALOGS/mask.cat" );
+    QVERIFY( antenna.open( QIODevice::WriteOnly | QIODevice::Text ) );
+    QVERIFY( equip.open( QIODevice::WriteOnly | QIODevice::Text ) );
+    QVERIFY( position.open( QIODevice::WriteOnly | QIODevice::Text ) );
+    QVERIFY( mask.open( QIODevice::WriteOnly | QIODevice::Text ) );
+    QTextStream ant( &antenna );
+    QTextStream eq( &equip );
+    QTextStream pos( &position );
+    QTextStream msk( &mask );
+    msk << "* no horizon masks\n";
+
+    const double a = 6378136.6;
+    const double f = 1 / 298.25642;
+    const double e2 = 2 * f - f * f;
+    for ( int i = 0; i < nCatalog_; ++i ) {
+        double lat = std::asin( std::max( -0.95, std::min( 0.95, 1.0 - 2.0 * ( i + 0.5 ) / nCatalog_ ) ) );
+        double lon = std::fmod( i * pi * ( 3.0 - std::sqrt( 5.0 ) ), 2 * pi ) - pi;
+        double nrad = a / std::sqrt( 1 - e2 * std::sin( lat ) * std::sin( lat ) );
+        double x = nrad * std::cos( lat ) * std::cos( lon );
+        double y = nrad * std::cos( lat ) * std::sin( lon );
+        double z = nrad * ( 1 - e2 ) * std::sin( lat );
+
+        QString name = QString( "SYN%1" ).arg( i, 3, 10, QChar( '0' ) );
+        QString id = QString( "%1%2" ).arg( QChar( 'A' + i / 26 % 26 ) ).arg( QChar( 'a' + i % 26 ) );
+        ant << "A " << name << " AZEL 0.0 180.0 0 -270.0 270.0 180.0 0 5.0 88.0 12.0 " << id << " " << id
+            << "-BB --\n";
+        eq << name << " " << id << "-BB 1024 MARK5B MK4 X 1000 S 1000\n";
+        pos << id << " " << name << " " << QString::number( x, 'f', 4 ) << " " << QString::number( y, 'f', 4 ) << " "
+            << QString::number( z, 'f', 4 ) << " 0000 " << QString::number( lon * 180 / pi, 'f', 4 ) << " "
+            << QString::number( lat * 180 / pi, 'f', 4 ) << " 0.0\n";
+        names_.append( name );
+    }
+}
+
+void NetworkSelectionBenchmark::clearSelection() {
+    while ( selected_->rowCount() > 0 ) {
+        QVERIFY( QMetaObject::invokeMethod( window_, "on_treeView_allSelectedStations_clicked",
+                                            Q_ARG( QModelIndex, selected_->index( 0, 0 ) ) ) );
+    }
+    createBaselineModel();
+    QCOMPARE( baselines_->rowCount(), 0 );
+}
+
+void NetworkSelectionBenchmark::checkBaselines( int nsta ) {
+    QCOMPARE( selected_->rowCount(), nsta );
+    QCOMPARE( baselines_->rowCount(), nsta * ( nsta - 1 ) / 2 );
+
+    auto baselines = [this]() {
+        QStringList list;
+        for ( int i = 0; i < baselines_->rowCount(); ++i ) {
+            list.append( baselines_->index( i, 0 ).data().toString() + " " +
+                         baselines_->index( i, 1 ).data().toString() );
+        }
+        return list;
+    };
+    auto series = [this]() {
+        QStringList list;
+        for ( const auto &any : worldmap_->chart()->series() ) {
+            if ( any->attachedAxes().size() != 2 ) {
+                list.append( "not attached: " + any->name() );
+            }
+            list.append( any->name() );
+        }
+        list.sort();
+        return list;
+    };
+    QStringList incremental = baselines();
+    QStringList incrementalSeries = series();
+    QStringList sorted = incremental;
+    sorted.sort();
+    QCOMPARE( incremental, sorted );
+
+    createBaselineModel();
+    QCOMPARE( incremental, baselines() );
+    QCOMPARE( incrementalSeries, series() );
+}
+
+void NetworkSelectionBenchmark::selectOneByOne() {
+    clearSelection();
+    const int n = 60;
+    QBENCHMARK_ONCE {
+        for ( int i = 0; i < n; ++i ) {
+            QModelIndexList match =
+                available_->match( available_->index( 0, 0 ), Qt::DisplayRole, names_.at( i ), 1, Qt::MatchExactly );
+            QCOMPARE( match.size(), 1 );
+            QVERIFY( QMetaObject::invokeMethod( window_, "on_treeView_allAvailabeStations_clicked",
+                                                Q_ARG( QModelIndex, match.first() ) ) );
+        }
+    }
+    checkBaselines( n );
+}
+
+void NetworkSelectionBenchmark::selectNetwork() {
+    clearSelection();
+    QStringList unknown;
+    QBENCHMARK_ONCE { unknown = window_->selectStations( names_ ); }
+    QVERIFY( unknown.isEmpty() );
+    checkBaselines( nCatalog_ );
+}
+
+QTEST_MAIN( NetworkSelectionBenchmark )
+
+#include "NetworkSelectionBenchmark.moc"
@@ -0,0 +1,150 @@
+ # 
+ #  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ #  Copyright (C) 2018  Matthias Schartner
+ #
+ #  This program is free software: you can redistribute it and/or modify
+ #  it under the terms of the GNU General Public License as published by
+ #  the Free Software Foundation, either version 3 of the License, or
+ #  (at your option) any later version.
+ #
+ #  This program is distributed in the hope that it will be useful,
+ #  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ #  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ #  GNU General Public License for more details.
+ #  
+ #  You should have received a copy of the GNU General Public License
+ #  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ #
+
+#-------------------------------------------------
+#
+# QTest benchmark of the station selection in the main window
+#
+#-------------------------------------------------
+CONFIG += c++14 console testcase
+CONFIG -= app_bundle
+CONFIG(release, debug|release):message(Release build)
+CONFIG(debug, debug|release):message(Debug build)
+
+QMAKE_CXXFLAGS+= -fopenmp
+LIBS += -fopenmp
+
+QT += core gui charts concurrent widgets testlib
+DEFINES += VieSchedppOnline=false
+
+# Comment the following lines for offline installation only without QT NETWORK
+# -----------------------
+QT += network
+DEFINES += VieSchedppOnline=true
+# -----------------------
+
+TARGET = NetworkSelectionBenchmark
+TEMPLATE = app
+
+INCLUDEPATH += $$PWD/..
+INCLUDEPATH += ../../VieSchedpp/EIGEN
+INCLUDEPATH += ../../VieSchedpp/EIGEN/Dense
+unix {
+    IAU_SOFA_PATH=$${IAU_SOFA}
+    isEmpty(IAU_SOFA_PATH) {
+        exists( ../../IAU_SOFA/Release/libsofa_c.a ){
+            LIBS += ../../IAU_SOFA/Release/libsofa_c.a
+            message(IAU SOFA found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }else{
+            message(IAU SOFA not found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }
+    } else {
+        exists( $${IAU_SOFA_PATH} ){
+            LIBS += $${IAU_SOFA_PATH}
+            message(IAU SOFA found at $${IAU_SOFA_PATH})
+        }else{
+            message(IAU SOFA not found at $${IAU_SOFA_PATH})
+        }
+    }
+
+    PATH_SGP4=$${SGP4}
+    isEmpty(PATH_SGP4) {
+        exists( ../../sgp4/Release/libsgp4/libsgp4.a ){
+            LIBS += ../../sgp4/Release/libsgp4/libsgp4.a
+            message(SGP4 found at ../../sgp4/Release/libsgp4/libsgp4.a)
+        }else{
+            message(SGP4 not found at ../../sgp4/Release/libsgp4/libsgp4.a)
+        }
+    } else {
+        exists( $${PATH_SGP4} ){
+            LIBS += $${PATH_SGP4}
+            message(SGP4 found at $${PATH_SGP4})
+        }else{
+            message(SGP4 not found at $${PATH_SGP4})
+        }
+    }
+}
+
+# for my windows builds
+win32{
+
+#    QMAKE_CXXFLAGS += -Wa,-mbig-obj
+
+    BOOST_PATH=$${BOOST}
+    isEmpty(BOOST_PATH) {
+        exists( ../../boost_1_74_0 ){
+            INCLUDEPATH += ../../boost_1_74_0
+            message(BOOST found at ../../boost_1_74_0)
+        }else{
+            message(BOOST not found at ../../boost_1_74_0)
+        }
+    } else {
+        exists( $${BOOST_PATH} ){
+            INCLUDEPATH += $${BOOST_PATH}
+            message(BOOST found at $${BOOST_PATH})
+        }else{
+            message(BOOST not found at $${BOOST_PATH})
+        }
+    }
+
+    IAU_SOFA_PATH=$${IAU_SOFA}
+    isEmpty(IAU_SOFA_PATH) {
+        exists( ../../IAU_SOFA/Release/libsofa_c.a ){
+            LIBS += ../../IAU_SOFA/Release/libsofa_c.a
+            message(IAU SOFA found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }else{
+            message(IAU SOFA not found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }
+    } else {
+        exists( $${IAU_SOFA_PATH} ){
+            LIBS += $${IAU_SOFA_PATH}
+            message(IAU SOFA found at $${IAU_SOFA_PATH})
+        }else{
+            message(IAU SOFA not found at $${IAU_SOFA_PATH})
+        }
+    }
+
+    PATH_SGP4=$${SGP4}
+    isEmpty(PATH_SGP4) {
+        exists( ../../sgp4/Release/libsgp4/sgp4.lib ){
+            LIBS += ../../sgp4/Release/libsgp4/sgp4.lib
+            message(SGP4 found at ../../sgp4/Release/libsgp4/sgp4.lib)
+        }else{
+            message(SGP4 not found at ../../sgp4/Release/libsgp4/sgp4.lib)
+        }
+    } else {
+        exists( $${PATH_SGP4} ){
+            LIBS += $${PATH_SGP4}
+            message(SGP4 found at $${PATH_SGP4})
+        }else{
+            message(SGP4 not found at $${PATH_SGP4})
+        }
+    }
+}
+
+include(../VieSchedppGUI.pri)
+
+SOURCES += \
+    NetworkSelectionBenchmark.cpp
+
+RESOURCES += \
+        ../myresources.qrc
+
+DEFINES += BOOST_ALL_NO_LIB
+DEFINES += GIT_COMMIT_HASH=\\\"unknown\\\"
+DEFINES += GIT_SCHEDULER_COMMIT_HASH=\\\"unknown\\\"
@@ -0,0 +1,229 @@
+ # 
+ #  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ #  Copyright (C) 2018  Matthias Schartner
+ #
+ #  This program is free software: you can redistribute it and/or modify
+ #  it under the terms of the GNU General Public License as published by
+ #  the Free Software Foundation, either version 3 of the License, or
+ #  (at your option) any later version.
+ #
+ #  This program is distributed in the hope that it will be useful,
+ #  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ #  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ #  GNU General Public License for more details.
+ #  
+ #  You should have received a copy of the GNU General Public License
+ #  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ #
+
+#-------------------------------------------------
+#
+# Console benchmark of the satellite scheduling pipeline
+#
+#-------------------------------------------------
+CONFIG += c++14 console
+CONFIG -= app_bundle
+CONFIG(release, debug|release):message(Release build)
+CONFIG(debug, debug|release):message(Debug build)
+
+QMAKE_CXXFLAGS+= -fopenmp
+LIBS += -fopenmp
+
+QT -= core gui
+
+TARGET = SatelliteBenchmark
+TEMPLATE = app
+
+# SatelliteGUI headers include ../VieSchedpp/... relative to the repository root
+INCLUDEPATH += $$PWD/..
+INCLUDEPATH += ../../VieSchedpp/EIGEN
+INCLUDEPATH += ../../VieSchedpp/EIGEN/Dense
+unix {
+    IAU_SOFA_PATH=$${IAU_SOFA}
+    isEmpty(IAU_SOFA_PATH) {
+        exists( ../../IAU_SOFA/Release/libsofa_c.a ){
+            LIBS += ../../IAU_SOFA/Release/libsofa_c.a
+            message(IAU SOFA found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }else{
+            message(IAU SOFA not found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }
+    } else {
+        exists( $${IAU_SOFA_PATH} ){
+            LIBS += $${IAU_SOFA_PATH}
+            message(IAU SOFA found at $${IAU_SOFA_PATH})
+        }else{
+            message(IAU SOFA not found at $${IAU_SOFA_PATH})
+        }
+    }
+
+    PATH_SGP4=$${SGP4}
+    isEmpty(PATH_SGP4) {
+        exists( ../../sgp4/Release/libsgp4/libsgp4.a ){
+            LIBS += ../../sgp4/Release/libsgp4/libsgp4.a
+            message(SGP4 found at ../../sgp4/Release/libsgp4/libsgp4.a)
+        }else{
+            message(SGP4 not found at ../../sgp4/Release/libsgp4/libsgp4.a)
+        }
+    } else {
+        exists( $${PATH_SGP4} ){
+            LIBS += $${PATH_SGP4}
+            message(SGP4 found at $${PATH_SGP4})
+        }else{
+            message(SGP4 not found at $${PATH_SGP4})
+        }
+    }
+}
+
+# for my windows builds
+win32{
+
+#    QMAKE_CXXFLAGS += -Wa,-mbig-obj
+
+    BOOST_PATH=$${BOOST}
+    isEmpty(BOOST_PATH) {
+        exists( ../../boost_1_74_0 ){
+            INCLUDEPATH += ../../boost_1_74_0
+            message(BOOST found at ../../boost_1_74_0)
+        }else{
+            message(BOOST not found at ../../boost_1_74_0)
+        }
+    } else {
+        exists( $${BOOST_PATH} ){
+            INCLUDEPATH += $${BOOST_PATH}
+            message(BOOST found at $${BOOST_PATH})
+        }else{
+            message(BOOST not found at $${BOOST_PATH})
+        }
+    }
+
+    IAU_SOFA_PATH=$${IAU_SOFA}
+    isEmpty(IAU_SOFA_PATH) {
+        exists( ../../IAU_SOFA/Release/libsofa_c.a ){
+            LIBS += ../../IAU_SOFA/Release/libsofa_c.a
+            message(IAU SOFA found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }else{
+            message(IAU SOFA not found at ../../IAU_SOFA/Release/libsofa_c.a)
+        }
+    } else {
+        exists( $${IAU_SOFA_PATH} ){
+            LIBS += $${IAU_SOFA_PATH}
+            message(IAU SOFA found at $${IAU_SOFA_PATH})
+        }else{
+            message(IAU SOFA not found at $${IAU_SOFA_PATH})
+        }
+    }
+
+    PATH_SGP4=$${SGP4}
+    isEmpty(PATH_SGP4) {
+        exists( ../../sgp4/Release/libsgp4/sgp4.lib ){
+            LIBS += ../../sgp4/Release/libsgp4/sgp4.lib
+            message(SGP4 found at ../../sgp4/Release/libsgp4/sgp4.lib)
+        }else{
+            message(SGP4 not found at ../../sgp4/Release/libsgp4/sgp4.lib)
+        }
+    } else {
+        exists( $${PATH_SGP4} ){
+            LIBS += $${PATH_SGP4}
+            message(SGP4 found at $${PATH_SGP4})
+        }else{
+            message(SGP4 not found at $${PATH_SGP4})
+        }
+    }
+}
+
+SOURCES += \
+    main.cpp \
+    ../../VieSchedpp/GlobalOptScheduler.cpp \
+    ../../VieSchedpp/Input/LogParser.cpp \
+    ../../VieSchedpp/Input/SkdCatalogReader.cpp \
+    ../../VieSchedpp/Input/SkdParser.cpp \
+    ../../VieSchedpp/Input/StpParser.cpp \
+    ../../VieSchedpp/Misc/AvoidSatellites.cpp \
+    ../../VieSchedpp/Misc/AstronomicalParameters.cpp \
+    ../../VieSchedpp/Misc/AstrometricCalibratorBlock.cpp \
+    ../../VieSchedpp/Misc/Flags.cpp \
+    ../../VieSchedpp/Misc/HighImpactScanDescriptor.cpp \
+    ../../VieSchedpp/Misc/CalibratorBlock.cpp \
+    ../../VieSchedpp/Misc/ParallacticAngleBlock.cpp \
+    ../../VieSchedpp/Misc/DifferentialParallacticAngleBlock.cpp \
+    ../../VieSchedpp/Misc/LookupTable.cpp \
+    ../../VieSchedpp/Misc/MultiScheduling.cpp \
+    ../../VieSchedpp/Misc/StationEndposition.cpp \
+    ../../VieSchedpp/Misc/TimeSystem.cpp \
+    ../../VieSchedpp/Misc/util.cpp \
+    ../../VieSchedpp/Misc/VieVS_NamedObject.cpp \
+    ../../VieSchedpp/Misc/VieVS_Object.cpp \
+    ../../VieSchedpp/Misc/WeightFactors.cpp \
+    ../../VieSchedpp/ObservingMode/Bbc.cpp \
+    ../../VieSchedpp/ObservingMode/Freq.cpp \
+    ../../VieSchedpp/ObservingMode/If.cpp \
+    ../../VieSchedpp/ObservingMode/Mode.cpp \
+    ../../VieSchedpp/ObservingMode/ObservingMode.cpp \
+    ../../VieSchedpp/ObservingMode/Track.cpp \
+    ../../VieSchedpp/Output/Output.cpp \
+    ../../VieSchedpp/Output/Skd.cpp \
+    ../../VieSchedpp/Output/Vex.cpp \
+    ../../VieSchedpp/Output/Ast.cpp \
+    ../../VieSchedpp/Output/SNR_table.cpp \
+    ../../VieSchedpp/Output/OperationNotes.cpp \
+    ../../VieSchedpp/Output/SourceStatistics.cpp \
+    ../../VieSchedpp/Scan/Observation.cpp \
+    ../../VieSchedpp/Scan/PointingVector.cpp \
+    ../../VieSchedpp/Scan/Scan.cpp \
+    ../../VieSchedpp/Scan/ScanTimes.cpp \
+    ../../VieSchedpp/Scan/Subcon.cpp \
+    ../../VieSchedpp/Source/Flux/AbstractFlux.cpp \
+    ../../VieSchedpp/Source/Flux/Flux_B.cpp \
+    ../../VieSchedpp/Source/Flux/Flux_M.cpp \
+    ../../VieSchedpp/Source/Flux/Flux_constant.cpp \
+    ../../VieSchedpp/Source/AbstractSource.cpp \
+    ../../VieSchedpp/Source/Quasar.cpp \
+    ../../VieSchedpp/Source/Satellite.cpp \
+    ../../VieSchedpp/Source/SourceList.cpp \
+    ../../VieSchedpp/Station/Antenna/AbstractAntenna.cpp \
+    ../../VieSchedpp/Station/Antenna/Antenna_GGAO.cpp \
+    ../../VieSchedpp/Station/Antenna/Antenna_ONSALA_VGOS.cpp \
+    ../../VieSchedpp/Station/Antenna/Antenna_AzEl.cpp \
+    ../../VieSchedpp/Station/Antenna/Antenna_AzEl_acceleration.cpp \
+    ../../VieSchedpp/Station/Antenna/Antenna_HaDc.cpp \
+    ../../VieSchedpp/Station/Antenna/Antenna_XYew.cpp \
+    ../../VieSchedpp/Station/CableWrap/AbstractCableWrap.cpp \
+    ../../VieSchedpp/Station/CableWrap/CableWrap_AzEl.cpp \
+    ../../VieSchedpp/Station/CableWrap/CableWrap_HaDc.cpp \
+    ../../VieSchedpp/Station/CableWrap/CableWrap_XYew.cpp \
+    ../../VieSchedpp/Station/Equip/AbstractEquipment.cpp \
+    ../../VieSchedpp/Station/Equip/Equipment_elModel.cpp \
+    ../../VieSchedpp/Station/Equip/Equipment_constant.cpp \
+    ../../VieSchedpp/Station/Equip/Equipment_elTable.cpp \
+    ../../VieSchedpp/Station/HorizonMask/AbstractHorizonMask.cpp \
+    ../../VieSchedpp/Station/HorizonMask/HorizonMask_line.cpp \
+    ../../VieSchedpp/Station/HorizonMask/HorizonMask_step.cpp \
+    ../../VieSchedpp/Station/Baseline.cpp \
+    ../../VieSchedpp/Station/Network.cpp \
+    ../../VieSchedpp/Station/Position.cpp \
+    ../../VieSchedpp/Station/SkyCoverage.cpp \
+    ../../VieSchedpp/Station/Station.cpp \
+    ../../VieSchedpp/XML/ParameterGroup.cpp \
+    ../../VieSchedpp/XML/ParameterSettings.cpp \
+    ../../VieSchedpp/XML/ParameterSetup.cpp \
+    ../../VieSchedpp/Scheduler.cpp \
+    ../../VieSchedpp/VieSchedpp.cpp \
+    ../../VieSchedpp/Initializer.cpp \
+    ../../VieSchedpp/Algorithm/FocusCorners.cpp \
+    ../../VieSchedpp/Simulator/Simulator.cpp \
+    ../../VieSchedpp/Simulator/Solver.cpp \
+    ../../VieSchedpp/Simulator/Unknown.cpp \
+    ../SatelliteGUI/SatelliteAvoidancePreview.cpp \
+    ../SatelliteGUI/SatelliteBatchPropagator.cpp \
+    ../SatelliteGUI/SatelliteCatalog.cpp \
+    ../SatelliteGUI/SatelliteCoverageIndex.cpp \
+    ../SatelliteGUI/SatelliteEphemeris.cpp \
+    ../SatelliteGUI/SatelliteForGUI.cpp \
+    ../SatelliteGUI/SatelliteMain.cpp \
+    ../SatelliteGUI/SatelliteObs.cpp \
+    ../SatelliteGUI/SatelliteOutput.cpp \
+    ../SatelliteGUI/SatelliteScanAssembler.cpp
+
+DEFINES += BOOST_ALL_NO_LIB
+DEFINES += GIT_COMMIT_HASH=\\\"unknown\\\"
+DEFINES += GIT_SCHEDULER_COMMIT_HASH=\\\"unknown\\\"
@@ -0,0 +1,502 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Console benchmark of the satellite scheduling pipeline.
+ *
+ * Synthetic TLE sets (GNSS-like MEO constellation and LEO Walker shells) and synthetic station networks (written as
+ * sked catalogs) are generated, each stage of the pipeline is timed and the scans are reduced to a checksum so that
+ * runs can be compared over time. In addition the struct-of-arrays SGP4 propagator is verified against the scalar
+ * SGP4 implementation.
+ *
+ * usage: SatelliteBenchmark [--leo 10,100,1000,5000] [--meo 24] [--stations 8] [--hours 24] [--threads n]
+ *
+ * The exit code is 1 if the batch propagator exceeds its tolerance or a short rate violation of a LEO passing close to
+ * the zenith is not found.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <sys/resource.h>
+#endif
+#include "../SatelliteGUI/SatelliteAvoidancePreview.h"
+#include "../SatelliteGUI/SatelliteBatchPropagator.h"
+#include "../SatelliteGUI/SatelliteCatalog.h"
+#include "../SatelliteGUI/SatelliteMain.h"
+
+namespace {
+    const double pi = 3.14159265358979323846;
+
+    /**
+     * @brief command line options
+     */
+    struct Options {
+        std::vector<int> leo{10, 100, 1000, 5000};  ///< sizes of the LEO shells
+        int meo = 24;                               ///< size of the MEO constellation (0 to skip)
+        int stations = 8;                           ///< number of stations
+        double hours = 24;                          ///< session duration
+        int threads = 0;                            ///< number of threads (0: OpenMP default)
+    };
+
+    /**
+     * @brief timer of one stage
+     */
+    class Stopwatch {
+       public:
+        Stopwatch() : start_( std::chrono::steady_clock::now() ) {}
+
+        double seconds() const {
+            return std::chrono::duration<double>( std::chrono::steady_clock::now() - start_ ).count();
+        }
+
+       private:
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    // peak resident memory [MB], -1 if not available on this platform
+    double peakMemory() {
+#if defined( __APPLE__ )
+        struct rusage usage;
+        getrusage( RUSAGE_SELF, &usage );
+        return usage.ru_maxrss / 1024.0 / 1024.0;
+#elif defined( __unix__ )
+        struct rusage usage;
+        getrusage( RUSAGE_SELF, &usage );
+        return usage.ru_maxrss / 1024.0;
+#else
+        return -1;
+#endif
+    }
+
+    void report( const std::string &constellation, const std::string &stage, double seconds, double items,
+                 const std::string &unit ) {
+        char buffer[200];
+        snprintf( buffer, sizeof( buffer ), "%-12s %-24s %10.3f s %12.0f %-12s %12.1f /s %10.1f MB",
+                  constellation.c_str(), stage.c_str(), seconds, items, unit.c_str(),
+                  seconds > 0 ? items / seconds : 0.0, peakMemory() );
+        std::cout << buffer << std::endl;
+    }
+
+    // FNV-1a hash
+    void hash( std::uint64_t &h, std::int64_t value ) {
+        for ( int i = 0; i < 8; ++i ) {
+            h ^= static_cast<std::uint64_t>( value >> ( 8 * i ) ) & 0xff;
+            h *= 1099511628211ull;
+        }
+    }
+
+    // modulo 10 checksum of a TLE line (digits count by value, '-' counts 1)
+    char tleChecksum( const std::string &line ) {
+        int sum = 0;
+        for ( char c : line ) {
+            if ( c >= '0' && c <= '9' ) {
+                sum += c - '0';
+            } else if ( c == '-' ) {
+                sum += 1;
+            }
+        }
+        return static_cast<char>( '0' + sum % 10 );
+    }
+
+    /**
+     * @brief writes one TLE in the fixed column format
+     */
+    void writeTle( std::ofstream &of, const std::string &name, int norad, int epochYear, double epochDay, double inc,
+                   double raan, double ecc, double argp, double ma, double meanMotion ) {
+        char l1[80];
+        char l2[80];
+        snprintf( l1, sizeof( l1 ), "1 %05dU %02d%03dA   %02d%012.8f  .00000000  00000-0  10000-4 0  999", norad,
+                  epochYear % 100, norad % 1000, epochYear % 100, epochDay );
+        snprintf( l2, sizeof( l2 ), "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%5d", norad, inc, raan,
+                  static_cast<int>( std::lround( ecc * 1e7 ) ), argp, ma, meanMotion, 1 );
+        std::string line1( l1 );
+        std::string line2( l2 );
+        of << name << "\n" << line1 << tleChecksum( line1 ) << "\n" << line2 << tleChecksum( line2 ) << "\n";
+    }
+
+    /**
+     * @brief Walker delta constellation: planes with equally spaced nodes, equally spaced satellites per plane
+     *
+     * @param planes number of orbital planes, 0 for round(sqrt(n))
+     */
+    void writeWalker( const std::string &file, const std::string &prefix, int n, double inc, double meanMotion,
+                      int norad0, int planes = 0 ) {
+        std::ofstream of( file );
+        if ( planes <= 0 ) {
+            planes = static_cast<int>( std::lround( std::sqrt( static_cast<double>( n ) ) ) );
+        }
+        planes = std::max( 1, std::min( planes, n ) );
+        int perPlane = ( n + planes - 1 ) / planes;
+        for ( int i = 0; i < n; ++i ) {
+            int plane = i / perPlane;
+            int slot = i % perPlane;
+            double raan = 360.0 * plane / planes;
+            double ma = std::fmod( 360.0 * slot / perPlane + 360.0 * plane / n, 360.0 );
+            char name[32];
+            snprintf( name, sizeof( name ), "%s-%04d", prefix.c_str(), i );
+            writeTle( of, name, norad0 + i, 2024, 1.0, inc, raan, 0.0001, 90.0, ma, meanMotion );
+        }
+    }
+
+    /**
+     * @brief synthetic stations in sked catalog format at geodetic latitude and longitude [rad]
+     *
+     * The AzEl antennas slew with rate [deg/min] in both axes.
+     */
+    std::vector<std::string> writeStations( const std::vector<std::pair<double, double>> &latLon, double rate,
+                                            const std::string &prefix, const std::string &antenna,
+                                            const std::string &equip, const std::string &position,
+                                            const std::string &mask ) {
+        std::ofstream ant( antenna );
+        std::ofstream eq( equip );
+        std::ofstream pos( position );
+        std::ofstream msk( mask );
+        msk << "* no horizon masks\n";
+
+        const double a = 6378136.6;
+        const double f = 1 / 298.25642;
+        const double e2 = 2 * f - f * f;
+        std::vector<std::string> names;
+        for ( std::size_t i = 0; i < latLon.size(); ++i ) {
+            double lat = latLon[i].first;
+            double lon = latLon[i].second;
+            double nrad = a / std::sqrt( 1 - e2 * std::sin( lat ) * std::sin( lat ) );
+            double x = nrad * std::cos( lat ) * std::cos( lon );
+            double y = nrad * std::cos( lat ) * std::sin( lon );
+            double z = nrad * ( 1 - e2 ) * std::sin( lat );
+
+            char name[16];
+            char id[3] = {static_cast<char>( 'A' + i / 26 % 26 ), static_cast<char>( 'a' + i % 26 ), '\0'};
+            snprintf( name, sizeof( name ), "%s%03d", prefix.c_str(), static_cast<int>( i ) );
+            ant << "A " << name << " AZEL 0.0 " << rate << " 0 -270.0 270.0 " << rate << " 0 5.0 88.0 12.0 " << id
+                << " " << id << "-BB --\n";
+            eq << name << " " << id << "-BB 1024 MARK5B MK4 X 1000 S 1000\n";
+            char line[200];
+            snprintf( line, sizeof( line ), "%s %s %.4f %.4f %.4f 0000 %.4f %.4f 0.0\n", id, name, x, y, z,
+                      lon * 180 / pi, lat * 180 / pi );
+            pos << line;
+            names.emplace_back( name );
+        }
+        return names;
+    }
+
+    /**
+     * @brief synthetic network in sked catalog format, stations equally distributed on a Fibonacci sphere
+     */
+    std::vector<std::string> writeNetwork( int n, const std::string &antenna, const std::string &equip,
+                                           const std::string &position, const std::string &mask ) {
+        std::vector<std::pair<double, double>> latLon;
+        for ( int i = 0; i < n; ++i ) {
+            double lat = std::asin( std::max( -0.95, std::min( 0.95, 1.0 - 2.0 * ( i + 0.5 ) / n ) ) );
+            double lon = std::fmod( i * pi * ( 3.0 - std::sqrt( 5.0 ) ), 2 * pi ) - pi;
+            latLon.emplace_back( lat, lon );
+        }
+        return writeStations( latLon, 180.0, "SYN", antenna, equip, position, mask );
+    }
+
+    /**
+     * @brief compares the batch propagator with the scalar SGP4
+     *
+     * @return true if the differences are within the documented tolerance
+     */
+    bool checkBatchPropagator( const std::string &constellation, const std::vector<Tle> &tles,
+                               const DateTime &start, double hours ) {
+        std::vector<double> offsets{0.0, hours * 1800.0, hours * 3600.0};
+        SatelliteBatchPropagator batch( tles );
+        SatelliteBatchPropagator::Deviation dev;
+        double tBatch = 0;
+        double tScalar = 0;
+        for ( double offset : offsets ) {
+            DateTime t = start.AddSeconds( offset );
+            Stopwatch swBatch;
+            batch.propagate( t );
+            tBatch += swBatch.seconds();
+
+            Stopwatch swScalar;
+            SatelliteBatchPropagator::Deviation d = batch.compareWithScalar( tles, t );
+            tScalar += swScalar.seconds();
+            dev.position = std::max( dev.position, d.position );
+            dev.velocity = std::max( dev.velocity, d.velocity );
+        }
+        double n = static_cast<double>( tles.size() * offsets.size() );
+        report( constellation, "SGP4 scalar", tScalar, n, "states" );
+        report( constellation, "SGP4 batch", tBatch, n, "states" );
+        bool ok = dev.withinTolerance();
+        std::cout << constellation << " batch vs scalar: max |dr| " << dev.position << " km, max |dv| " << dev.velocity
+                  << " km/s " << ( ok ? "[ok]" : "[FAILED]" ) << std::endl;
+        return ok;
+    }
+
+    /**
+     * @brief runs all stages for one constellation
+     *
+     * @return true if all checks passed
+     */
+    bool run( const std::string &constellation, const std::string &tleFile, SatelliteMain &main,
+              const DateTime &start, const DateTime &end, double hours ) {
+        Stopwatch sw;
+        SatelliteCatalog catalog( tleFile );
+        report( constellation, "read catalog", sw.seconds(), catalog.size(), "satellites" );
+
+        std::vector<Tle> tles;
+        for ( const auto &sat : catalog.getSatellites() ) {
+            tles.emplace_back( sat.getHeader(), sat.getLine1(), sat.getLine2() );
+        }
+        bool ok = checkBatchPropagator( constellation, tles, start, hours );
+
+        const std::vector<SatelliteForGUI> &satellites = catalog.getSatellites();
+        const VieVS::Network &network = main.refNetwork();
+        int nsat = static_cast<int>( satellites.size() );
+        int nsta = static_cast<int>( network.getNSta() );
+
+        sw = Stopwatch();
+        #pragma omp parallel for schedule(dynamic)
+        for ( int i = 0; i < nsat; ++i ) {
+            satellites[i].getEphemeris();
+        }
+        report( constellation, "ephemeris", sw.seconds(), nsat, "satellites" );
+
+        // passes of all (satellite, station) pairs
+        std::vector<std::vector<std::vector<SatelliteForGUI::SatPass>>> passLists(
+            nsat, std::vector<std::vector<SatelliteForGUI::SatPass>>( nsta ) );
+        sw = Stopwatch();
+        #pragma omp parallel for schedule(dynamic)
+        for ( int task = 0; task < nsat * nsta; ++task ) {
+            passLists[task / nsta][task % nsta] =
+                satellites[task / nsta].generatePassList( network.getStation( task % nsta ), start, end, 60 );
+        }
+        double tPasses = sw.seconds();
+        std::size_t nPasses = 0;
+        for ( const auto &perSat : passLists ) {
+            for ( const auto &perSta : perSat ) {
+                nPasses += perSta.size();
+            }
+        }
+        report( constellation, "generatePassList", tPasses, nPasses, "passes" );
+
+        // validation of the final passes only, generatePassList already contains one call per raw pass
+        sw = Stopwatch();
+        std::size_t nChecked = 0;
+        #pragma omp parallel for schedule(dynamic) reduction(+ : nChecked)
+        for ( int task = 0; task < nsat * nsta; ++task ) {
+            const SatelliteForGUI &sat = satellites[task / nsta];
+            const VieVS::Station &station = network.getStation( task % nsta );
+            auto sun = SatelliteForGUI::azelSunCached( station );
+            auto eph = sat.getEphemeris();
+            for ( const auto &pass : passLists[task / nsta][task % nsta] ) {
+                nChecked += sat.checkSatPass( pass, start, *eph, station, *sun ).size();
+            }
+        }
+        report( constellation, "checkSatPass", sw.seconds(), nPasses, "passes" );
+
+        // scan assembly
+        sw = Stopwatch();
+        std::vector<VieVS::Scan> scans;
+        for ( int i = 0; i < nsat; ++i ) {
+            auto list = SatelliteObs::createScanList( passLists[i], network, satellites[i], start );
+            scans.insert( scans.end(), list.begin(), list.end() );
+        }
+        report( constellation, "createScanList", sw.seconds(), scans.size(), "scans" );
+
+        // whole pipeline, first without and then with cached passes
+        sw = Stopwatch();
+        main.clearPassCache();
+        std::vector<VieVS::Scan> all = main.generateScanList( satellites );
+        report( constellation, "generateScanList", sw.seconds(), nPasses, "passes" );
+        sw = Stopwatch();
+        std::vector<VieVS::Scan> cached = main.generateScanList( satellites );
+        report( constellation, "generateScanList cached", sw.seconds(), cached.size(), "scans" );
+
+        // checksum independent of object ids: satellite catalog index, station index and observing times
+        std::uint64_t checksum = 14695981039346656037ull;
+        for ( const auto &scan : all ) {
+            hash( checksum, catalog.findId( scan.getSourceId() ) );
+            for ( int i = 0; i < static_cast<int>( scan.getNSta() ); ++i ) {
+                hash( checksum, static_cast<std::int64_t>( scan.getPointingVector( i ).getStaid() ) );
+                hash( checksum, scan.getTimes().getObservingTime( i, VieVS::Timestamp::start ) );
+                hash( checksum, scan.getTimes().getObservingTime( i, VieVS::Timestamp::end ) );
+            }
+        }
+        bool same = all.size() == scans.size() && cached.size() == scans.size();
+        std::cout << constellation << " scans " << all.size() << " checksum " << std::hex << checksum << std::dec
+                  << ( same ? "" : " [stage and pipeline scan counts differ]" ) << std::endl;
+
+        // satellite avoidance preview with the constellation as avoidance catalog, 100 sources on a spiral
+        std::vector<SatelliteAvoidancePreview::Station> stations;
+        for ( const auto &sta : network.getStations() ) {
+            stations.push_back( {sta.getName(), sta.getPosition()->getX(), sta.getPosition()->getY(),
+                                 sta.getPosition()->getZ(), sta.getPosition()->getLat(), sta.getPosition()->getLon()} );
+        }
+        std::vector<SatelliteAvoidancePreview::Source> sources;
+        for ( int i = 0; i < 100; ++i ) {
+            sources.push_back( {"SRC" + std::to_string( i ), std::fmod( i * pi * ( 3.0 - std::sqrt( 5.0 ) ), 2 * pi ),
+                                std::asin( 1.0 - 2.0 * ( i + 0.5 ) / 100 )} );
+        }
+        SatelliteAvoidancePreview preview;
+        preview.setCatalog( tles );
+        SatelliteAvoidancePreview::Parameters para;
+        para.checkFrequency = 30;
+        sw = Stopwatch();
+        auto result = preview.compute( stations, sources, start, static_cast<unsigned int>( hours * 3600 ), para );
+        report( constellation, "avoidance preview", sw.seconds(),
+                static_cast<double>( result.nBins ) * stations.size() * sources.size(), "cells" );
+
+        return ok;
+    }
+
+    /**
+     * @brief regression check of the tracking check for a LEO passing 3 degrees from the zenith of an AzEl antenna
+     *
+     * The station is placed 30 km beside the ground track, the azimuth rate peaks at about 14 deg/s and exceeds the
+     * slew rate of 6 deg/s for less than 10 seconds around the closest approach. This part has to be removed from
+     * the pass.
+     *
+     * @return true if the pass is split at the closest approach
+     */
+    bool checkNearZenithPass( const DateTime &start, const DateTime &end, boost::posix_time::ptime startTime,
+                              boost::posix_time::ptime endTime ) {
+        writeWalker( "benchmark_zenith.tle", "ZEN", 1, 53.0, 15.06, 60000 );
+        SatelliteCatalog catalog( "benchmark_zenith.tle" );
+        const SatelliteForGUI &sat = catalog.getSatellites().front();
+
+        // sub satellite point and ground track direction at the closest approach
+        DateTime closest = start.AddSeconds( 1800 );
+        SGP4 sgp4( Tle( sat.getHeader(), sat.getLine1(), sat.getLine2() ) );
+        CoordGeodetic p0 = sgp4.FindPosition( closest ).ToGeodetic();
+        CoordGeodetic p1 = sgp4.FindPosition( closest.AddSeconds( 1 ) ).ToGeodetic();
+        double north = p1.latitude - p0.latitude;
+        double east = std::remainder( p1.longitude - p0.longitude, 2 * pi ) * std::cos( p0.latitude );
+        double norm = std::sqrt( north * north + east * east );
+        double offset = 30.0 / 6371.0;
+        double lat = p0.latitude + offset * east / norm;
+        double lon = p0.longitude - offset * north / norm / std::cos( p0.latitude );
+
+        std::vector<std::string> names = writeStations( {{lat, lon}}, 360.0, "ZEN", "benchmark_zenith_antenna.cat",
+                                                        "benchmark_zenith_equip.cat", "benchmark_zenith_position.cat",
+                                                        "benchmark_zenith_mask.cat" );
+        SatelliteMain zenith;
+        zenith.initialize( "benchmark_zenith_antenna.cat", "benchmark_zenith_equip.cat",
+                           "benchmark_zenith_position.cat", "benchmark_zenith_mask.cat", startTime, endTime, names );
+        if ( zenith.refNetwork().getNSta() != 1 ) {
+            std::cout << "near zenith pass: station not initialized [FAILED]" << std::endl;
+            return false;
+        }
+
+        bool covered = false;
+        bool before = false;
+        bool after = false;
+        for ( const auto &pass : sat.generatePassList( zenith.refNetwork().getStation( 0 ), start, end, 60 ) ) {
+            double toStart = ( pass.start - closest ).TotalSeconds();
+            double toEnd = ( pass.end - closest ).TotalSeconds();
+            covered = covered || ( toStart <= 0 && toEnd >= 0 );
+            before = before || ( toEnd < 0 && toEnd > -30 );
+            after = after || ( toStart > 0 && toStart < 30 );
+        }
+        bool ok = !covered && before && after;
+        std::cout << "near zenith pass: rate violation at closest approach " << ( ok ? "[ok]" : "[FAILED]" )
+                  << std::endl;
+        return ok;
+    }
+
+    std::vector<int> parseList( const std::string &txt ) {
+        std::vector<int> values;
+        std::stringstream ss( txt );
+        std::string item;
+        while ( std::getline( ss, item, ',' ) ) {
+            values.push_back( std::atoi( item.c_str() ) );
+        }
+        return values;
+    }
+}  // namespace
+
+int main( int argc, char *argv[] ) {
+    Options opt;
+    for ( int i = 1; i + 1 < argc; i += 2 ) {
+        std::string key = argv[i];
+        std::string value = argv[i + 1];
+        if ( key == "--leo" ) {
+            opt.leo = parseList( value );
+        } else if ( key == "--meo" ) {
+            opt.meo = std::atoi( value.c_str() );
+        } else if ( key == "--stations" ) {
+            opt.stations = std::atoi( value.c_str() );
+        } else if ( key == "--hours" ) {
+            opt.hours = std::atof( value.c_str() );
+        } else if ( key == "--threads" ) {
+            opt.threads = std::atoi( value.c_str() );
+        } else {
+            std::cerr << "unknown option " << key << std::endl;
+            return 2;
+        }
+    }
+#ifdef _OPENMP
+    if ( opt.threads > 0 ) {
+        omp_set_num_threads( opt.threads );
+    }
+    std::cout << "threads: " << omp_get_max_threads() << std::endl;
+#endif
+
+    // synthetic network, session starts at the TLE epoch
+    boost::posix_time::ptime startTime( boost::gregorian::date( 2024, 1, 1 ), boost::posix_time::time_duration( 0, 0, 0 ) );
+    boost::posix_time::ptime endTime = startTime + boost::posix_time::seconds( static_cast<long>( opt.hours * 3600 ) );
+    std::vector<std::string> names = writeNetwork( opt.stations, "benchmark_antenna.cat", "benchmark_equip.cat",
+                                                   "benchmark_position.cat", "benchmark_mask.cat" );
+    SatelliteMain main;
+    Stopwatch sw;
+    main.initialize( "benchmark_antenna.cat", "benchmark_equip.cat", "benchmark_position.cat", "benchmark_mask.cat",
+                     startTime, endTime, names );
+    report( "network", "initialize", sw.seconds(), main.refNetwork().getNSta(), "stations" );
+    if ( main.refNetwork().getNSta() != static_cast<unsigned long>( opt.stations ) ) {
+        std::cerr << "only " << main.refNetwork().getNSta() << " of " << opt.stations << " stations initialized"
+                  << std::endl;
+    }
+
+    DateTime start( 2024, 1, 1, 0, 0, 0 );
+    DateTime end = start.AddSeconds( opt.hours * 3600 );
+    std::cout << "constellation stage                          time        items                  rate       peak"
+              << std::endl;
+
+    bool ok = true;
+    if ( opt.meo > 0 ) {
+        // GNSS-like: 3 planes, 55 deg inclination, two revolutions per sidereal day
+        writeWalker( "benchmark_meo.tle", "MEO", opt.meo, 55.0, 2.00563, 40000, 3 );
+        ok = run( "MEO-" + std::to_string( opt.meo ), "benchmark_meo.tle", main, start, end, opt.hours ) && ok;
+    }
+    for ( int n : opt.leo ) {
+        // Starlink-like shell: 550 km altitude, 53 deg inclination
+        writeWalker( "benchmark_leo.tle", "LEO", n, 53.0, 15.06, 50000 );
+        ok = run( "LEO-" + std::to_string( n ), "benchmark_leo.tle", main, start, end, opt.hours ) && ok;
+    }
+    ok = checkNearZenithPass( start, end, startTime, endTime ) && ok;
+
+    return ok ? 0 : 1;
+}
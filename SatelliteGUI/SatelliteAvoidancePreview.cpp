@@ -0,0 +1,244 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SatelliteAvoidancePreview.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include "../VieSchedpp/SGP4/Globals.h"
+#include "SatelliteBatchPropagator.h"
+
+void SatelliteAvoidancePreview::setCatalog( const std::vector<Tle> &tles ) {
+    bool same = tles.size() == tles_.size();
+    for ( std::size_t i = 0; same && i < tles.size(); ++i ) {
+        same = tles[i].Line1() == tles_[i].Line1() && tles[i].Line2() == tles_[i].Line2();
+    }
+    if ( same ) {
+        return;
+    }
+
+    tles_ = tles;
+    tleEpoch_.clear();
+    for ( const auto &tle : tles_ ) {
+        tleEpoch_.push_back( tle.Epoch().Ticks() );
+    }
+    cache_.clear();
+    cacheBins_ = 0;
+}
+
+SatelliteAvoidancePreview::Result SatelliteAvoidancePreview::compute( const std::vector<Station> &stations,
+                                                                      const std::vector<Source> &sources,
+                                                                      const DateTime &start, unsigned int duration,
+                                                                      const Parameters &para,
+                                                                      SatelliteProgress *progress ) {
+    if ( para.checkFrequency == 0 ) {
+        throw "Check frequency must be positive!";
+    }
+    if ( maskBytes( stations.size(), sources.size(), duration, para.checkFrequency ) > maxMaskBytes ) {
+        throw "Satellite avoidance preview too large, increase the check frequency or select less sources!";
+    }
+    const double deg2rad = kPI / 180.0;
+    const std::size_t nsta = stations.size();
+    const std::size_t nsrc = sources.size();
+    const std::size_t nsat = tles_.size();
+    const unsigned int binLength = para.checkFrequency;
+    const unsigned int nBins = duration / binLength + 1;
+
+    Result res;
+    res.nBins = nBins;
+    res.binLength = binLength;
+    res.nStations = nsta;
+    res.nSources = nsrc;
+    res.mask.assign( nsta * nsrc * nBins, 0 );
+    res.visibleMinutes.assign( nsrc, 0.0 );
+    res.lostMinutes.assign( nsrc, 0.0 );
+
+    // station position [km] and local vertical
+    std::vector<double> stax( nsta ), stay( nsta ), staz( nsta ), upx( nsta ), upy( nsta ), upz( nsta );
+    for ( std::size_t i = 0; i < nsta; ++i ) {
+        stax[i] = stations[i].x / 1000.0;
+        stay[i] = stations[i].y / 1000.0;
+        staz[i] = stations[i].z / 1000.0;
+        upx[i] = cos( stations[i].lat ) * cos( stations[i].lon );
+        upy[i] = cos( stations[i].lat ) * sin( stations[i].lon );
+        upz[i] = sin( stations[i].lat );
+    }
+
+    // precession J2000 -> mean equator of date (IAU 1976) at the middle of the session
+    double tcen = start.AddSeconds( duration / 2.0 ).ToJ2000() / 36525.0;
+    double arcsec = deg2rad / 3600.0;
+    double zeta = ( 2306.2181 * tcen + 0.30188 * tcen * tcen + 0.017998 * tcen * tcen * tcen ) * arcsec;
+    double z = ( 2306.2181 * tcen + 1.09468 * tcen * tcen + 0.018203 * tcen * tcen * tcen ) * arcsec;
+    double theta = ( 2004.3109 * tcen - 0.42665 * tcen * tcen - 0.041833 * tcen * tcen * tcen ) * arcsec;
+    double p[3][3] = {
+        {cos( zeta ) * cos( z ) * cos( theta ) - sin( zeta ) * sin( z ),
+         -sin( zeta ) * cos( z ) * cos( theta ) - cos( zeta ) * sin( z ), -cos( z ) * sin( theta )},
+        {cos( zeta ) * sin( z ) * cos( theta ) + sin( zeta ) * cos( z ),
+         -sin( zeta ) * sin( z ) * cos( theta ) + cos( zeta ) * cos( z ), -sin( z ) * sin( theta )},
+        {cos( zeta ) * sin( theta ), -sin( zeta ) * sin( theta ), cos( theta )}};
+
+    std::vector<double> srcx( nsrc ), srcy( nsrc ), srcz( nsrc );
+    for ( std::size_t i = 0; i < nsrc; ++i ) {
+        double v[3] = {cos( sources[i].de ) * cos( sources[i].ra ), cos( sources[i].de ) * sin( sources[i].ra ),
+                       sin( sources[i].de )};
+        srcx[i] = p[0][0] * v[0] + p[0][1] * v[1] + p[0][2] * v[2];
+        srcy[i] = p[1][0] * v[0] + p[1][1] * v[1] + p[1][2] * v[2];
+        srcz[i] = p[2][0] * v[0] + p[2][1] * v[1] + p[2][2] * v[2];
+    }
+
+    // ephemeris cache
+    const std::int64_t startTicks = start.Ticks();
+    const std::size_t cacheSize = static_cast<std::size_t>( nBins ) * nsat * 3;
+    const bool useCache = cacheSize * sizeof( float ) <= maxCacheBytes;
+    const bool cached = useCache && nsat > 0 && cacheStart_ == startTicks && cacheBins_ == nBins &&
+                        cacheBinLength_ == binLength && cache_.size() == cacheSize;
+    const bool fill = useCache && !cached;
+    if ( fill ) {
+        cacheBins_ = 0;
+        cache_.assign( cacheSize, std::numeric_limits<float>::quiet_NaN() );
+    } else if ( !useCache ) {
+        cacheBins_ = 0;
+        cache_.clear();
+        cache_.shrink_to_fit();
+    }
+
+    const double sinMinEl = sin( para.minElevation * deg2rad );
+    const double extraMargin = para.extraMargin * deg2rad;
+    if ( progress != nullptr ) {
+        progress->done = 0;
+        progress->total = static_cast<int>( nBins );
+    }
+
+    #pragma omp parallel
+    {
+        // SGP4 keeps state for deep space objects, every thread needs its own propagator
+        std::unique_ptr<SatelliteBatchPropagator> propagator;
+        if ( !cached ) {
+            propagator.reset( new SatelliteBatchPropagator( tles_ ) );
+        }
+        std::vector<double> ex( nsat ), ey( nsat ), ez( nsat );
+        std::vector<double> dx, dy, dz, cosMargin;
+
+        #pragma omp for schedule(dynamic)
+        for ( int ibin = 0; ibin < static_cast<int>( nBins ); ++ibin ) {
+            if ( progress != nullptr && progress->canceled ) {
+                continue;
+            }
+            DateTime time = start.AddSeconds( static_cast<double>( ibin ) * binLength );
+            double gmst = time.ToGreenwichSiderealTime();
+            double cg = cos( gmst );
+            double sg = sin( gmst );
+            float *row = useCache ? cache_.data() + static_cast<std::size_t>( ibin ) * nsat * 3 : nullptr;
+
+            // earth fixed satellite positions
+            if ( cached ) {
+                for ( std::size_t i = 0; i < nsat; ++i ) {
+                    ex[i] = row[3 * i];
+                    ey[i] = row[3 * i + 1];
+                    ez[i] = row[3 * i + 2];
+                }
+            } else {
+                propagator->propagate( time );
+                const auto &x = propagator->getX();
+                const auto &y = propagator->getY();
+                for ( std::size_t i = 0; i < nsat; ++i ) {
+                    ex[i] = cg * x[i] + sg * y[i];
+                    ey[i] = -sg * x[i] + cg * y[i];
+                    ez[i] = propagator->getZ()[i];
+                }
+                if ( fill ) {
+                    for ( std::size_t i = 0; i < nsat; ++i ) {
+                        row[3 * i] = static_cast<float>( ex[i] );
+                        row[3 * i + 1] = static_cast<float>( ey[i] );
+                        row[3 * i + 2] = static_cast<float>( ez[i] );
+                    }
+                }
+            }
+
+            for ( std::size_t ista = 0; ista < nsta; ++ista ) {
+                // satellites above minimum elevation: direction and effective margin
+                dx.clear();
+                dy.clear();
+                dz.clear();
+                cosMargin.clear();
+                for ( std::size_t i = 0; i < nsat; ++i ) {
+                    double rx = ex[i] - stax[ista];
+                    double ry = ey[i] - stay[ista];
+                    double rz = ez[i] - staz[ista];
+                    double range = sqrt( rx * rx + ry * ry + rz * rz );
+                    if ( !( range > 0 ) || ( rx * upx[ista] + ry * upy[ista] + rz * upz[ista] ) < sinMinEl * range ) {
+                        continue;
+                    }
+                    double days = std::abs( static_cast<double>( time.Ticks() - tleEpoch_[i] ) ) / 86400.0e6;
+                    double orbitError = ( para.orbitError + para.orbitErrorPerDay * days ) / 1000.0;
+                    dx.push_back( rx / range );
+                    dy.push_back( ry / range );
+                    dz.push_back( rz / range );
+                    cosMargin.push_back( cos( extraMargin + atan( orbitError / range ) ) );
+                }
+
+                std::uint8_t *cell = res.mask.data() + ista * nsrc * nBins + ibin;
+                for ( std::size_t isrc = 0; isrc < nsrc; ++isrc, cell += nBins ) {
+                    double sx = cg * srcx[isrc] + sg * srcy[isrc];
+                    double sy = -sg * srcx[isrc] + cg * srcy[isrc];
+                    double sz = srcz[isrc];
+                    if ( sx * upx[ista] + sy * upy[ista] + sz * upz[ista] <= 0 ) {
+                        continue;
+                    }
+                    std::uint8_t flag = visible;
+                    for ( std::size_t k = 0; k < cosMargin.size(); ++k ) {
+                        if ( sx * dx[k] + sy * dy[k] + sz * dz[k] >= cosMargin[k] ) {
+                            flag |= blocked;
+                            break;
+                        }
+                    }
+                    *cell = flag;
+                }
+            }
+            if ( progress != nullptr ) {
+                ++progress->done;
+            }
+        }
+    }
+    if ( progress != nullptr && progress->canceled ) {
+        return Result();
+    }
+    if ( fill ) {
+        cacheStart_ = startTicks;
+        cacheBins_ = nBins;
+        cacheBinLength_ = binLength;
+    }
+
+    const double binMinutes = binLength / 60.0;
+    for ( std::size_t ista = 0; ista < nsta; ++ista ) {
+        for ( std::size_t isrc = 0; isrc < nsrc; ++isrc ) {
+            const std::uint8_t *cell = res.mask.data() + ( ista * nsrc + isrc ) * nBins;
+            for ( unsigned int ibin = 0; ibin < nBins; ++ibin ) {
+                if ( cell[ibin] & visible ) {
+                    res.visibleMinutes[isrc] += binMinutes;
+                    if ( cell[ibin] & blocked ) {
+                        res.lostMinutes[isrc] += binMinutes;
+                    }
+                }
+            }
+        }
+    }
+
+    return res;
+}
@@ -0,0 +1,160 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIESCHEDPP_SATELLITEAVOIDANCEPREVIEW_H
+#define VIESCHEDPP_SATELLITEAVOIDANCEPREVIEW_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../VieSchedpp/SGP4/DateTime.h"
+#include "../VieSchedpp/SGP4/Tle.h"
+#include "SatelliteProgress.h"
+
+/**
+ * @brief estimates the observing time lost due to satellite avoidance before the scheduler is started
+ *
+ * The session is split into bins of checkFrequency seconds. For every bin, station and source a flag is computed which
+ * tells if the source is above the horizon of the station and if any satellite of the avoidance catalog is closer to
+ * the source than the effective angular margin
+ *
+ *      margin = extraMargin + atan( ( orbitError + orbitErrorPerDay * |t - TLE epoch| ) / range ).
+ *
+ * Satellites below minElevation are ignored, the same rule as in the scheduler. Source positions are precessed from
+ * J2000 to the mean equator of date (IAU 1976), nutation and station masks are neglected.
+ *
+ * The bins are processed in parallel, each thread uses its own SatelliteBatchPropagator. Earth fixed satellite
+ * positions of all bins are cached (single precision) as long as they fit into maxCacheBytes, therefore changing the
+ * network, the source list or the margins does not propagate the catalog again.
+ */
+class SatelliteAvoidancePreview {
+   public:
+    /**
+     * @brief satellite avoidance parameters
+     */
+    struct Parameters {
+        double extraMargin = 0.2;         ///< additional angular margin [deg]
+        double orbitError = 2000;         ///< orbit error at TLE epoch [m]
+        double orbitErrorPerDay = 2000;   ///< increase of orbit error per day [m/day]
+        unsigned int checkFrequency = 5;  ///< time resolution [s]
+        double minElevation = 20;         ///< minimum elevation of avoided satellites [deg]
+    };
+
+    /**
+     * @brief station
+     */
+    struct Station {
+        std::string name;  ///< station name
+        double x;          ///< earth fixed x coordinate [m]
+        double y;          ///< earth fixed y coordinate [m]
+        double z;          ///< earth fixed z coordinate [m]
+        double lat;        ///< latitude [rad]
+        double lon;        ///< longitude [rad]
+    };
+
+    /**
+     * @brief source
+     */
+    struct Source {
+        std::string name;  ///< source name
+        double ra;         ///< right ascension J2000 [rad]
+        double de;         ///< declination J2000 [rad]
+    };
+
+    /**
+     * @brief blocked-mask grid and summary
+     */
+    struct Result {
+        unsigned int nBins = 0;          ///< number of time bins
+        unsigned int binLength = 0;      ///< length of one time bin [s]
+        std::size_t nStations = 0;       ///< number of stations
+        std::size_t nSources = 0;        ///< number of sources
+        std::vector<std::uint8_t> mask;  ///< [station][source][bin] combination of MaskFlag
+        std::vector<double> visibleMinutes;  ///< per source, sum over stations of minutes above horizon
+        std::vector<double> lostMinutes;     ///< per source, sum over stations of visible minutes blocked by satellites
+
+        std::uint8_t at( std::size_t ista, std::size_t isrc, unsigned int ibin ) const {
+            return mask[( ista * nSources + isrc ) * nBins + ibin];
+        }
+    };
+
+    /**
+     * @brief flags of one (station, source, time bin) cell
+     */
+    enum MaskFlag : std::uint8_t {
+        visible = 1,  ///< source is above the horizon
+        blocked = 2,  ///< a satellite is within the effective margin
+    };
+
+    static constexpr std::size_t maxCacheBytes = 512u * 1024u * 1024u;  ///< maximum size of the ephemeris cache
+    static constexpr std::size_t maxMaskBytes = 512u * 1024u * 1024u;   ///< maximum size of the blocked-mask grid
+
+    /**
+     * @brief size of the blocked-mask grid, compute() refuses grids larger than maxMaskBytes
+     *
+     * @param nStations number of stations
+     * @param nSources number of sources
+     * @param duration session duration [s]
+     * @param checkFrequency time resolution [s]
+     * @return size of the grid [bytes]
+     */
+    static std::size_t maskBytes( std::size_t nStations, std::size_t nSources, unsigned int duration,
+                                  unsigned int checkFrequency ) noexcept {
+        return nStations * nSources * ( duration / checkFrequency + 1 ) * sizeof( std::uint8_t );
+    }
+
+    /**
+     * @brief sets the avoidance catalog, the ephemeris cache is kept if the catalog did not change
+     *
+     * @param tles catalog
+     */
+    void setCatalog( const std::vector<Tle> &tles );
+
+    /**
+     * @brief number of satellites in catalog
+     *
+     * @return number of satellites
+     */
+    std::size_t numberOfSatellites() const noexcept { return tles_.size(); }
+
+    /**
+     * @brief computes the blocked-mask grid
+     *
+     * @param stations network
+     * @param sources source list
+     * @param start session start
+     * @param duration session duration [s]
+     * @param para avoidance parameters
+     * @param progress optional progress (finished bins, total bins), polled by the caller, set canceled to cancel
+     * @return blocked-mask grid, empty if canceled
+     */
+    Result compute( const std::vector<Station> &stations, const std::vector<Source> &sources, const DateTime &start,
+                    unsigned int duration, const Parameters &para, SatelliteProgress *progress = nullptr );
+
+   private:
+    std::vector<Tle> tles_;                 ///< avoidance catalog
+    std::vector<std::int64_t> tleEpoch_;    ///< TLE epochs [ticks]
+
+    // ephemeris cache, earth fixed satellite positions [bin][satellite][xyz] in km, NaN if propagation failed
+    std::int64_t cacheStart_ = 0;      ///< session start of cache [ticks]
+    unsigned int cacheBins_ = 0;       ///< number of bins in cache
+    unsigned int cacheBinLength_ = 0;  ///< bin length of cache [s]
+    std::vector<float> cache_;         ///< cached positions
+};
+
+#endif  // VIESCHEDPP_SATELLITEAVOIDANCEPREVIEW_H
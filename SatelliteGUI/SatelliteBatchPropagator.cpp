@@ -0,0 +1,378 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SatelliteBatchPropagator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include "../VieSchedpp/SGP4/DecayedException.h"
+#include "../VieSchedpp/SGP4/Globals.h"
+#include "../VieSchedpp/SGP4/OrbitalElements.h"
+
+SatelliteBatchPropagator::SatelliteBatchPropagator( const std::vector<Tle> &tles ) {
+    std::size_t n = tles.size();
+    for ( std::size_t i = 0; i < n; ++i ) {
+        OrbitalElements elements( tles[i] );
+        if ( elements.Eccentricity() < 0.0 || elements.Eccentricity() > 0.999 || elements.Inclination() < 0.0 ||
+             elements.Inclination() > kPI ) {
+            invalidIdx_.push_back( i );
+        } else if ( elements.Period() >= 225.0 ) {
+            try {
+                deepSpaceSgp4_.emplace_back( new SGP4( tles[i] ) );
+                deepSpaceIdx_.push_back( i );
+            } catch ( ... ) {
+                invalidIdx_.push_back( i );
+            }
+        } else {
+            addNearEarth( i, tles[i] );
+        }
+    }
+
+    x_.resize( n );
+    y_.resize( n );
+    z_.resize( n );
+    vx_.resize( n );
+    vy_.resize( n );
+    vz_.resize( n );
+    status_.resize( n, Status::error );
+}
+
+void SatelliteBatchPropagator::addNearEarth( std::size_t idx, const Tle &tle ) {
+    // same initialization as SGP4::Initialise() for the near earth model
+    OrbitalElements elements( tle );
+    const double eo = elements.Eccentricity();
+    const double xincl = elements.Inclination();
+    const double aodp = elements.RecoveredSemiMajorAxis();
+    const double xnodp = elements.RecoveredMeanMotion();
+    const double bstar = elements.BStar();
+    const double perigee = elements.Perigee();
+
+    const double cosio = cos( xincl );
+    const double sinio = sin( xincl );
+    const double theta2 = cosio * cosio;
+    const double x3thm1 = 3.0 * theta2 - 1.0;
+    const double x1mth2 = 1.0 - theta2;
+    const double x7thm1 = 7.0 * theta2 - 1.0;
+    const double xlcof = 0.125 * kA3OVK2 * sinio * ( 3.0 + 5.0 * cosio ) /
+                         ( fabs( cosio + 1.0 ) > 1.5e-12 ? 1.0 + cosio : 1.5e-12 );
+    const double aycof = 0.25 * kA3OVK2 * sinio;
+
+    const double eosq = eo * eo;
+    const double betao2 = 1.0 - eosq;
+    const double betao = sqrt( betao2 );
+
+    double s4 = kS;
+    double qoms24 = kQOMS2T;
+    if ( perigee < 156.0 ) {
+        s4 = perigee - 78.0;
+        if ( perigee < 98.0 ) {
+            s4 = 20.0;
+        }
+        qoms24 = pow( ( 120.0 - s4 ) * kAE / kXKMPER, 4.0 );
+        s4 = s4 / kXKMPER + kAE;
+    }
+
+    const double pinvsq = 1.0 / ( aodp * aodp * betao2 * betao2 );
+    const double tsi = 1.0 / ( aodp - s4 );
+    const double eta = aodp * eo * tsi;
+    const double etasq = eta * eta;
+    const double eeta = eo * eta;
+    const double psisq = fabs( 1.0 - etasq );
+    const double coef = qoms24 * pow( tsi, 4.0 );
+    const double coef1 = coef / pow( psisq, 3.5 );
+    const double c2 = coef1 * xnodp *
+                      ( aodp * ( 1.0 + 1.5 * etasq + eeta * ( 4.0 + etasq ) ) +
+                        0.75 * kCK2 * tsi / psisq * x3thm1 * ( 8.0 + 3.0 * etasq * ( 8.0 + etasq ) ) );
+    const double c1 = bstar * c2;
+    const double c4 =
+        2.0 * xnodp * coef1 * aodp * betao2 *
+        ( eta * ( 2.0 + 0.5 * etasq ) + eo * ( 0.5 + 2.0 * etasq ) -
+          2.0 * kCK2 * tsi / ( aodp * psisq ) *
+              ( -3.0 * x3thm1 * ( 1.0 - 2.0 * eeta + etasq * ( 1.5 - 0.5 * eeta ) ) +
+                0.75 * x1mth2 * ( 2.0 * etasq - eeta * ( 1.0 + etasq ) ) * cos( 2.0 * elements.ArgumentPerigee() ) ) );
+    const double theta4 = theta2 * theta2;
+    const double temp1 = 3.0 * kCK2 * pinvsq * xnodp;
+    const double temp2 = temp1 * kCK2 * pinvsq;
+    const double temp3 = 1.25 * kCK4 * pinvsq * pinvsq * xnodp;
+    const double xmdot =
+        xnodp + 0.5 * temp1 * betao * x3thm1 + 0.0625 * temp2 * betao * ( 13.0 - 78.0 * theta2 + 137.0 * theta4 );
+    const double x1m5th = 1.0 - 5.0 * theta2;
+    const double omgdot = -0.5 * temp1 * x1m5th + 0.0625 * temp2 * ( 7.0 - 114.0 * theta2 + 395.0 * theta4 ) +
+                          temp3 * ( 3.0 - 36.0 * theta2 + 49.0 * theta4 );
+    const double xhdot1 = -temp1 * cosio;
+    const double xnodot = xhdot1 + ( 0.5 * temp2 * ( 4.0 - 19.0 * theta2 ) + 2.0 * temp3 * ( 3.0 - 7.0 * theta2 ) ) * cosio;
+
+    double c3 = 0.0;
+    double xmcof = 0.0;
+    if ( eo > 1.0e-4 ) {
+        c3 = coef * tsi * kA3OVK2 * xnodp * kAE * sinio / eo;
+        xmcof = -kTWOTHIRD * coef * bstar * kAE / eeta;
+    }
+    double c5 = 2.0 * coef1 * aodp * betao2 * ( 1.0 + 2.75 * ( etasq + eeta ) + eeta * etasq );
+    double omgcof = bstar * c3 * cos( elements.ArgumentPerigee() );
+
+    double d2 = 0.0;
+    double d3 = 0.0;
+    double d4 = 0.0;
+    double t3cof = 0.0;
+    double t4cof = 0.0;
+    double t5cof = 0.0;
+    if ( perigee < 220.0 ) {
+        // simple model: the delta omega, delta m and c5 terms are dropped, zero coefficients remove them branch free
+        c5 = 0.0;
+        omgcof = 0.0;
+        xmcof = 0.0;
+    } else {
+        const double c1sq = c1 * c1;
+        d2 = 4.0 * aodp * tsi * c1sq;
+        const double temp = d2 * tsi * c1 / 3.0;
+        d3 = ( 17.0 * aodp + s4 ) * temp;
+        d4 = 0.5 * temp * aodp * tsi * ( 221.0 * aodp + 31.0 * s4 ) * c1;
+        t3cof = d2 + 2.0 * c1sq;
+        t4cof = 0.25 * ( 3.0 * d3 + c1 * ( 12.0 * d2 + 10.0 * c1sq ) );
+        t5cof = 0.2 * ( 3.0 * d4 + 12.0 * c1 * d3 + 6.0 * d2 * d2 + 15.0 * c1sq * ( 2.0 * d2 + c1sq ) );
+    }
+
+    nearIdx_.push_back( idx );
+    epoch_.push_back( elements.Epoch().Ticks() );
+    xmo_.push_back( elements.MeanAnomoly() );
+    omegao_.push_back( elements.ArgumentPerigee() );
+    xnodeo_.push_back( elements.AscendingNode() );
+    eo_.push_back( eo );
+    xincl_.push_back( xincl );
+    aodp_.push_back( aodp );
+    xnodp_.push_back( xnodp );
+    bstar_.push_back( bstar );
+    cosio_.push_back( cosio );
+    sinio_.push_back( sinio );
+    x3thm1_.push_back( x3thm1 );
+    x1mth2_.push_back( x1mth2 );
+    x7thm1_.push_back( x7thm1 );
+    xlcof_.push_back( xlcof );
+    aycof_.push_back( aycof );
+    eta_.push_back( eta );
+    c1_.push_back( c1 );
+    c4_.push_back( c4 );
+    c5_.push_back( c5 );
+    xmdot_.push_back( xmdot );
+    omgdot_.push_back( omgdot );
+    xnodot_.push_back( xnodot );
+    xnodcf_.push_back( 3.5 * betao2 * xhdot1 * c1 );
+    t2cof_.push_back( 1.5 * c1 );
+    omgcof_.push_back( omgcof );
+    xmcof_.push_back( xmcof );
+    delmo_.push_back( pow( 1.0 + eta * cos( elements.MeanAnomoly() ), 3.0 ) );
+    sinmo_.push_back( sin( elements.MeanAnomoly() ) );
+    d2_.push_back( d2 );
+    d3_.push_back( d3 );
+    d4_.push_back( d4 );
+    t3cof_.push_back( t3cof );
+    t4cof_.push_back( t4cof );
+    t5cof_.push_back( t5cof );
+}
+
+void SatelliteBatchPropagator::propagate( const DateTime &time ) {
+    const int n = static_cast<int>( nearIdx_.size() );
+    const std::int64_t ticks = time.Ticks();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // secular and drag effects
+    std::vector<double> xnode( n ), omega( n ), a( n ), e( n ), xl( n );
+    std::vector<char> bad( n );
+    #pragma omp parallel for simd schedule(static)
+    for ( int i = 0; i < n; ++i ) {
+        const double tsince = static_cast<double>( ticks - epoch_[i] ) / 60.0e6;
+        const double xmdf = xmo_[i] + xmdot_[i] * tsince;
+        const double omgadf = omegao_[i] + omgdot_[i] * tsince;
+        const double xnoddf = xnodeo_[i] + xnodot_[i] * tsince;
+        const double tsq = tsince * tsince;
+        const double tcube = tsq * tsince;
+        const double tfour = tsince * tcube;
+        const double delomg = omgcof_[i] * tsince;
+        const double delm = xmcof_[i] * ( pow( 1.0 + eta_[i] * cos( xmdf ), 3.0 ) - delmo_[i] );
+        const double temp = delomg + delm;
+        const double xmp = xmdf + temp;
+        omega[i] = omgadf - temp;
+        xnode[i] = xnoddf + xnodcf_[i] * tsq;
+        const double tempa = 1.0 - c1_[i] * tsince - d2_[i] * tsq - d3_[i] * tcube - d4_[i] * tfour;
+        const double tempe = bstar_[i] * c4_[i] * tsince + bstar_[i] * c5_[i] * ( sin( xmp ) - sinmo_[i] );
+        const double templ = t2cof_[i] * tsq + t3cof_[i] * tcube + tfour * ( t4cof_[i] + tsince * t5cof_[i] );
+        a[i] = aodp_[i] * tempa * tempa;
+        xl[i] = xmp + omega[i] + xnode[i] + xnodp_[i] * templ;
+        double ei = eo_[i] - tempe;
+        bad[i] = ei <= -0.001;
+        ei = ei < 1.0e-6 ? 1.0e-6 : ei;
+        ei = ei > 1.0 - 1.0e-6 ? 1.0 - 1.0e-6 : ei;
+        e[i] = ei;
+    }
+
+    // long period periodics
+    std::vector<double> axn( n ), ayn( n ), capu( n ), epw( n ), maxStep( n );
+    #pragma omp parallel for simd schedule(static)
+    for ( int i = 0; i < n; ++i ) {
+        const double beta2 = 1.0 - e[i] * e[i];
+        axn[i] = e[i] * cos( omega[i] );
+        const double temp11 = 1.0 / ( a[i] * beta2 );
+        const double xlt = xl[i] + temp11 * xlcof_[i] * axn[i];
+        ayn[i] = e[i] * sin( omega[i] ) + temp11 * aycof_[i];
+        const double elsq = axn[i] * axn[i] + ayn[i] * ayn[i];
+        bad[i] = bad[i] || elsq >= 1.0;
+        capu[i] = fmod( xlt - xnode[i], kTWOPI );
+        epw[i] = capu[i];
+        maxStep[i] = 1.25 * fabs( sqrt( elsq ) );
+    }
+
+    // Kepler's equation, lane-wise Newton-Raphson with the same iteration rules as the scalar model
+    std::vector<double> sinepw( n ), cosepw( n ), ecose( n ), esine( n );
+    std::vector<char> running( n, 1 );
+    for ( int it = 0; it < 10; ++it ) {
+        #pragma omp parallel for simd schedule(static)
+        for ( int i = 0; i < n; ++i ) {
+            if ( running[i] ) {
+                sinepw[i] = sin( epw[i] );
+                cosepw[i] = cos( epw[i] );
+                ecose[i] = axn[i] * cosepw[i] + ayn[i] * sinepw[i];
+                esine[i] = axn[i] * sinepw[i] - ayn[i] * cosepw[i];
+                const double f = capu[i] - epw[i] + esine[i];
+                if ( fabs( f ) < 1.0e-12 ) {
+                    running[i] = 0;
+                } else {
+                    const double fdot = 1.0 - ecose[i];
+                    double delta = f / fdot;
+                    if ( it == 0 ) {
+                        delta = delta > maxStep[i] ? maxStep[i] : ( delta < -maxStep[i] ? -maxStep[i] : delta );
+                    } else {
+                        delta = f / ( fdot + 0.5 * esine[i] * delta );
+                    }
+                    epw[i] += delta;
+                }
+            }
+        }
+    }
+
+    // short period periodics, orientation vectors, position and velocity
+    #pragma omp parallel for simd schedule(static)
+    for ( int i = 0; i < n; ++i ) {
+        const double xn = kXKE / pow( a[i], 1.5 );
+        const double elsq = axn[i] * axn[i] + ayn[i] * ayn[i];
+        const double temp21 = 1.0 - elsq;
+        const double pl = a[i] * temp21;
+        const double r = a[i] * ( 1.0 - ecose[i] );
+        const double temp31 = 1.0 / r;
+        const double rdot = kXKE * sqrt( a[i] ) * esine[i] * temp31;
+        const double rfdot = kXKE * sqrt( pl ) * temp31;
+        const double temp32 = a[i] * temp31;
+        const double betal = sqrt( temp21 );
+        const double temp33 = 1.0 / ( 1.0 + betal );
+        const double cosu = temp32 * ( cosepw[i] - axn[i] + ayn[i] * esine[i] * temp33 );
+        const double sinu = temp32 * ( sinepw[i] - ayn[i] - axn[i] * esine[i] * temp33 );
+        const double u = atan2( sinu, cosu );
+        const double sin2u = 2.0 * sinu * cosu;
+        const double cos2u = 2.0 * cosu * cosu - 1.0;
+
+        const double temp41 = 1.0 / pl;
+        const double temp42 = kCK2 * temp41;
+        const double temp43 = temp42 * temp41;
+        const double rk = r * ( 1.0 - 1.5 * temp43 * betal * x3thm1_[i] ) + 0.5 * temp42 * x1mth2_[i] * cos2u;
+        const double uk = u - 0.25 * temp43 * x7thm1_[i] * sin2u;
+        const double xnodek = xnode[i] + 1.5 * temp43 * cosio_[i] * sin2u;
+        const double xinck = xincl_[i] + 1.5 * temp43 * cosio_[i] * sinio_[i] * cos2u;
+        const double rdotk = rdot - xn * temp42 * x1mth2_[i] * sin2u;
+        const double rfdotk = rfdot + xn * temp42 * ( x1mth2_[i] * cos2u + 1.5 * x3thm1_[i] );
+
+        const double sinuk = sin( uk );
+        const double cosuk = cos( uk );
+        const double sinik = sin( xinck );
+        const double cosik = cos( xinck );
+        const double sinnok = sin( xnodek );
+        const double cosnok = cos( xnodek );
+        const double xmx = -sinnok * cosik;
+        const double xmy = cosnok * cosik;
+        const double ux = xmx * sinuk + cosnok * cosuk;
+        const double uy = xmy * sinuk + sinnok * cosuk;
+        const double uz = sinik * sinuk;
+        const double vx = xmx * cosuk - cosnok * sinuk;
+        const double vy = xmy * cosuk - sinnok * sinuk;
+        const double vz = sinik * cosuk;
+
+        const bool invalid = bad[i] || pl < 0.0;
+        const std::size_t k = nearIdx_[i];
+        x_[k] = invalid ? nan : rk * ux * kXKMPER;
+        y_[k] = invalid ? nan : rk * uy * kXKMPER;
+        z_[k] = invalid ? nan : rk * uz * kXKMPER;
+        vx_[k] = invalid ? nan : ( rdotk * ux + rfdotk * vx ) * kXKMPER / 60.0;
+        vy_[k] = invalid ? nan : ( rdotk * uy + rfdotk * vy ) * kXKMPER / 60.0;
+        vz_[k] = invalid ? nan : ( rdotk * uz + rfdotk * vz ) * kXKMPER / 60.0;
+        status_[k] = invalid ? Status::error : ( rk < 1.0 ? Status::decayed : Status::ok );
+    }
+
+    // deep space objects with the scalar model
+    const int nDeep = static_cast<int>( deepSpaceIdx_.size() );
+    #pragma omp parallel for schedule(dynamic)
+    for ( int i = 0; i < nDeep; ++i ) {
+        const std::size_t k = deepSpaceIdx_[i];
+        Status status = Status::ok;
+        Eci eci( time, Vector( nan, nan, nan ), Vector( nan, nan, nan ) );
+        try {
+            eci = deepSpaceSgp4_[i]->FindPosition( time );
+        } catch ( DecayedException &e ) {
+            eci = Eci( time, e.Position(), e.Velocity() );
+            status = Status::decayed;
+        } catch ( ... ) {
+            status = Status::error;
+        }
+        x_[k] = eci.Position().x;
+        y_[k] = eci.Position().y;
+        z_[k] = eci.Position().z;
+        vx_[k] = eci.Velocity().x;
+        vy_[k] = eci.Velocity().y;
+        vz_[k] = eci.Velocity().z;
+        status_[k] = status;
+    }
+
+    for ( std::size_t k : invalidIdx_ ) {
+        x_[k] = y_[k] = z_[k] = vx_[k] = vy_[k] = vz_[k] = nan;
+        status_[k] = Status::error;
+    }
+}
+
+SatelliteBatchPropagator::Deviation SatelliteBatchPropagator::compareWithScalar( const std::vector<Tle> &tles,
+                                                                                 const DateTime &time ) const {
+    if ( tles.size() != size() ) {
+        throw "catalog does not match the batch propagator";
+    }
+    Deviation dev;
+    for ( std::size_t i = 0; i < tles.size(); ++i ) {
+        if ( status_[i] != Status::ok ) {
+            continue;
+        }
+        try {
+            SGP4 sgp4( tles[i] );
+            Eci eci = sgp4.FindPosition( time );
+            dev.position = std::max( {dev.position, std::abs( eci.Position().x - x_[i] ),
+                                      std::abs( eci.Position().y - y_[i] ), std::abs( eci.Position().z - z_[i] )} );
+            dev.velocity = std::max( {dev.velocity, std::abs( eci.Velocity().x - vx_[i] ),
+                                      std::abs( eci.Velocity().y - vy_[i] ), std::abs( eci.Velocity().z - vz_[i] )} );
+        } catch ( ... ) {
+            dev.position = std::numeric_limits<double>::infinity();
+        }
+    }
+    return dev;
+}
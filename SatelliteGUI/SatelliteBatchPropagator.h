@@ -0,0 +1,176 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIESCHEDPP_SATELLITEBATCHPROPAGATOR_H
+#define VIESCHEDPP_SATELLITEBATCHPROPAGATOR_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../VieSchedpp/SGP4/DateTime.h"
+#include "../VieSchedpp/SGP4/SGP4.h"
+#include "../VieSchedpp/SGP4/Tle.h"
+
+/**
+ * @brief propagates a whole TLE catalog with SGP4 in struct-of-arrays form
+ *
+ * The near earth SGP4 model (orbital period below 225 minutes, e.g. LEO constellations) is evaluated for all
+ * satellites of one epoch in flat loops over contiguous arrays without branches, so that the compiler can vectorize
+ * them. The "simple model" for perigees below 220 km is expressed by zero coefficients instead of a branch and the
+ * Kepler iteration is done lane-wise with a fixed number of iterations where converged lanes are frozen.
+ *
+ * The formulas, constants and iteration rules are the ones of the scalar SGP4 implementation used by
+ * SatelliteForGUI, only the evaluation order differs. Results agree with SGP4::FindPosition to positionTolerance and
+ * velocityTolerance (differences are floating point rounding only), compareWithScalar() checks this.
+ *
+ * Deep space objects (period of 225 minutes or more, e.g. GNSS, GEO) need the resonance integrator and are
+ * propagated with the scalar SGP4 instead.
+ *
+ * Errors do not throw, they are reported per satellite via getStatus().
+ */
+class SatelliteBatchPropagator {
+   public:
+    /**
+     * @brief propagation result of one satellite
+     */
+    enum class Status : char {
+        ok,       ///< position and velocity are valid
+        error,    ///< invalid elements or SGP4 error, position and velocity are NaN
+        decayed,  ///< satellite has decayed, position and velocity are valid but below the earth surface
+    };
+
+    static constexpr double positionTolerance = 1e-6;  ///< maximum difference to the scalar SGP4 per axis [km]
+    static constexpr double velocityTolerance = 1e-9;  ///< maximum difference to the scalar SGP4 per axis [km/s]
+
+    /**
+     * @brief largest difference of the batch results to the scalar SGP4
+     */
+    struct Deviation {
+        double position = 0;  ///< maximum position difference per axis [km], infinite if the scalar SGP4 failed
+        double velocity = 0;  ///< maximum velocity difference per axis [km/s]
+
+        bool withinTolerance() const noexcept {
+            return position <= positionTolerance && velocity <= velocityTolerance;
+        }
+    };
+
+    /**
+     * @brief constructor
+     *
+     * @param tles catalog
+     */
+    explicit SatelliteBatchPropagator( const std::vector<Tle> &tles );
+
+    /**
+     * @brief propagates all satellites to one epoch
+     *
+     * @param time epoch
+     */
+    void propagate( const DateTime &time );
+
+    /**
+     * @brief compares the results of the last propagate() with SGP4::FindPosition
+     *
+     * Only satellites with status ok are compared.
+     *
+     * @param tles catalog passed to the constructor
+     * @param time epoch passed to the last propagate()
+     * @return largest difference
+     */
+    Deviation compareWithScalar( const std::vector<Tle> &tles, const DateTime &time ) const;
+
+    /**
+     * @brief number of satellites
+     *
+     * @return number of satellites
+     */
+    std::size_t size() const noexcept { return status_.size(); }
+
+    /**
+     * @brief number of satellites which are propagated with the scalar deep space model
+     *
+     * @return number of deep space satellites
+     */
+    std::size_t numberOfDeepSpace() const noexcept { return deepSpaceIdx_.size(); }
+
+    const std::vector<double> &getX() const noexcept { return x_; }    ///< ECI x position [km]
+    const std::vector<double> &getY() const noexcept { return y_; }    ///< ECI y position [km]
+    const std::vector<double> &getZ() const noexcept { return z_; }    ///< ECI z position [km]
+    const std::vector<double> &getVx() const noexcept { return vx_; }  ///< ECI x velocity [km/s]
+    const std::vector<double> &getVy() const noexcept { return vy_; }  ///< ECI y velocity [km/s]
+    const std::vector<double> &getVz() const noexcept { return vz_; }  ///< ECI z velocity [km/s]
+    const std::vector<Status> &getStatus() const noexcept { return status_; }  ///< status of last propagate()
+
+   private:
+    // near earth satellites, index i of the arrays belongs to satellite nearIdx_[i]
+    std::vector<std::size_t> nearIdx_;  ///< catalog index of near earth satellite
+    std::vector<std::int64_t> epoch_;  ///< TLE epoch [ticks]
+    std::vector<double> xmo_;         ///< mean anomaly at epoch
+    std::vector<double> omegao_;      ///< argument of perigee at epoch
+    std::vector<double> xnodeo_;      ///< ascending node at epoch
+    std::vector<double> eo_;          ///< eccentricity
+    std::vector<double> xincl_;       ///< inclination
+    std::vector<double> aodp_;        ///< recovered semi major axis
+    std::vector<double> xnodp_;       ///< recovered mean motion
+    std::vector<double> bstar_;       ///< drag term
+    std::vector<double> cosio_;
+    std::vector<double> sinio_;
+    std::vector<double> x3thm1_;
+    std::vector<double> x1mth2_;
+    std::vector<double> x7thm1_;
+    std::vector<double> xlcof_;
+    std::vector<double> aycof_;
+    std::vector<double> eta_;
+    std::vector<double> c1_;
+    std::vector<double> c4_;
+    std::vector<double> c5_;
+    std::vector<double> xmdot_;
+    std::vector<double> omgdot_;
+    std::vector<double> xnodot_;
+    std::vector<double> xnodcf_;
+    std::vector<double> t2cof_;
+    std::vector<double> omgcof_;
+    std::vector<double> xmcof_;
+    std::vector<double> delmo_;
+    std::vector<double> sinmo_;
+    std::vector<double> d2_;
+    std::vector<double> d3_;
+    std::vector<double> d4_;
+    std::vector<double> t3cof_;
+    std::vector<double> t4cof_;
+    std::vector<double> t5cof_;
+
+    // deep space satellites
+    std::vector<std::size_t> deepSpaceIdx_;             ///< catalog index of deep space satellite
+    std::vector<std::unique_ptr<SGP4>> deepSpaceSgp4_;  ///< scalar propagator of deep space satellite
+
+    std::vector<std::size_t> invalidIdx_;  ///< catalog index of satellites with invalid elements
+
+    // results, indexed by catalog index
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> z_;
+    std::vector<double> vx_;
+    std::vector<double> vy_;
+    std::vector<double> vz_;
+    std::vector<Status> status_;
+
+    void addNearEarth( std::size_t idx, const Tle &tle );
+};
+
+#endif  // VIESCHEDPP_SATELLITEBATCHPROPAGATOR_H
@@ -0,0 +1,130 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SatelliteCatalog.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <boost/algorithm/string.hpp>
+
+namespace {
+    // numeric value of the fixed TLE columns [start, start+len), columns are counted from 0
+    double column( const std::string &line, std::size_t start, std::size_t len ) {
+        return std::strtod( line.substr( start, len ).c_str(), nullptr );
+    }
+
+    // NORAD catalog number, including the alpha-5 scheme (leading letter without I and O for numbers >= 100000)
+    int noradNumber( const std::string &field ) {
+        std::string digits = boost::trim_copy( field );
+        if ( !digits.empty() && std::isalpha( static_cast<unsigned char>( digits[0] ) ) ) {
+            char c = static_cast<char>( std::toupper( static_cast<unsigned char>( digits[0] ) ) );
+            int value = 10 + ( c - 'A' ) - ( c > 'I' ? 1 : 0 ) - ( c > 'O' ? 1 : 0 );
+            return value * 10000 + std::atoi( digits.substr( 1 ).c_str() );
+        }
+        return std::atoi( digits.c_str() );
+    }
+}  // namespace
+
+SatelliteCatalog::SatelliteCatalog( const std::string &filename ) {
+    std::ifstream fid( filename );
+    if ( !fid.is_open() ) {
+        throw "There was an error opening the file!";
+    }
+
+    std::string line;
+    std::string hdr;
+    std::string line1;
+    int flag = 0;
+    while ( getline( fid, line ) ) {
+        // TLE lines have fixed columns, only trailing white spaces (e.g. \r) are removed
+        boost::trim_right( line );
+        if ( line.empty() || line[0] == '*' || line[0] == '!' || line[0] == '&' ) {
+            continue;
+        }
+        switch ( flag ) {
+            case 0: {
+                hdr = boost::trim_copy( VieVS::util::simplify( line ) );
+                ++flag;
+                break;
+            }
+            case 1: {
+                line1 = line;
+                ++flag;
+                break;
+            }
+            default: {
+                add( hdr, line1, line );
+                flag = 0;
+                break;
+            }
+        }
+    }
+    if ( flag != 0 ) {
+        throw "Wrong file format for satellite file! Please check the required format!";
+    }
+}
+
+void SatelliteCatalog::add( const std::string &hdr, const std::string &line1, const std::string &line2 ) {
+    if ( line1.size() < 69 || line1[0] != '1' || line2.size() < 69 || line2[0] != '2' ) {
+        throw "Wrong file format for satellite file! Please check the required format!";
+    }
+
+    Entry entry;
+    entry.name = hdr;
+    entry.line1 = line1.substr( 0, 69 );
+    entry.line2 = line2.substr( 0, 69 );
+    entry.noradId = noradNumber( line1.substr( 2, 5 ) );
+    entry.designator = boost::trim_copy( line1.substr( 9, 8 ) );
+    int year = static_cast<int>( column( line1, 18, 2 ) );
+    entry.epochYear = year < 57 ? 2000 + year : 1900 + year;
+    entry.epochDay = column( line1, 20, 12 );
+    entry.inclination = column( line2, 8, 8 );
+    entry.raan = column( line2, 17, 8 );
+    entry.eccentricity = column( "." + line2.substr( 26, 7 ), 0, 8 );
+    entry.argPerigee = column( line2, 34, 8 );
+    entry.meanAnomaly = column( line2, 43, 8 );
+    entry.meanMotion = column( line2, 52, 11 );
+
+    try {
+        satellites_.emplace_back( hdr, entry.line1, entry.line2 );
+    } catch ( ... ) {
+        throw "Wrong file format for satellite file! Please check the required format!";
+    }
+
+    int idx = static_cast<int>( entries_.size() );
+    byName_.emplace( entry.name, idx );
+    byNoradId_.emplace( entry.noradId, idx );
+    byId_.emplace( satellites_.back().getId(), idx );
+    entries_.push_back( std::move( entry ) );
+}
+
+int SatelliteCatalog::findName( const std::string &name ) const {
+    auto it = byName_.find( name );
+    return it == byName_.end() ? -1 : it->second;
+}
+
+int SatelliteCatalog::findNoradId( int noradId ) const {
+    auto it = byNoradId_.find( noradId );
+    return it == byNoradId_.end() ? -1 : it->second;
+}
+
+int SatelliteCatalog::findId( unsigned long id ) const {
+    auto it = byId_.find( id );
+    return it == byId_.end() ? -1 : it->second;
+}
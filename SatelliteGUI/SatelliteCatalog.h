@@ -0,0 +1,120 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIESCHEDPP_SATELLITECATALOG_H
+#define VIESCHEDPP_SATELLITECATALOG_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SatelliteForGUI.h"
+
+/**
+ * @brief TLE catalog which is read once and shared by the main window and the satellite scheduling window
+ *
+ * The orbital elements that are shown in the GUI are parsed from their fixed TLE columns. Entries can be found by
+ * name, NORAD catalog number and satellite id in constant time. The SatelliteForGUI objects only parse the TLE,
+ * their SGP4 propagators are created when they are first needed.
+ */
+class SatelliteCatalog {
+   public:
+    /**
+     * @brief orbital elements of one TLE as shown in the GUI
+     */
+    struct Entry {
+        std::string name;         ///< satellite name (header line)
+        std::string line1;        ///< first TLE line
+        std::string line2;        ///< second TLE line
+        int noradId = 0;          ///< NORAD catalog number
+        std::string designator;   ///< international designator
+        int epochYear = 0;        ///< epoch year (four digits)
+        double epochDay = 0;      ///< epoch day of year including fraction (January 1st 0h is 1.0)
+        double inclination = 0;   ///< inclination [deg]
+        double raan = 0;          ///< right ascension of ascending node [deg]
+        double eccentricity = 0;  ///< eccentricity
+        double argPerigee = 0;    ///< argument of perigee [deg]
+        double meanAnomaly = 0;   ///< mean anomaly [deg]
+        double meanMotion = 0;    ///< mean motion [revolutions/day]
+    };
+
+    /**
+     * @brief reads a TLE file (header line + two TLE lines per satellite)
+     *
+     * Empty lines and comment lines starting with '*', '!' or '&' are ignored.
+     *
+     * @param filename path to TLE file
+     */
+    explicit SatelliteCatalog( const std::string &filename );
+
+    /**
+     * @brief number of satellites
+     *
+     * @return number of satellites
+     */
+    std::size_t size() const noexcept { return entries_.size(); }
+
+    /**
+     * @brief orbital elements of a satellite
+     *
+     * @param idx catalog index
+     * @return orbital elements
+     */
+    const Entry &getEntry( std::size_t idx ) const { return entries_[idx]; }
+
+    /**
+     * @brief satellites in catalog order
+     *
+     * @return satellites
+     */
+    const std::vector<SatelliteForGUI> &getSatellites() const noexcept { return satellites_; }
+
+    /**
+     * @brief catalog index of a satellite name
+     *
+     * @param name satellite name
+     * @return catalog index or -1 if not found (first entry if the name is used multiple times)
+     */
+    int findName( const std::string &name ) const;
+
+    /**
+     * @brief catalog index of a NORAD catalog number
+     *
+     * @param noradId NORAD catalog number
+     * @return catalog index or -1 if not found
+     */
+    int findNoradId( int noradId ) const;
+
+    /**
+     * @brief catalog index of a satellite id (VieVS_Object::getId(), e.g. scan source id)
+     *
+     * @param id satellite id
+     * @return catalog index or -1 if not found
+     */
+    int findId( unsigned long id ) const;
+
+   private:
+    std::vector<Entry> entries_;                     ///< orbital elements
+    std::vector<SatelliteForGUI> satellites_;        ///< satellites
+    std::unordered_map<std::string, int> byName_;    ///< catalog index per name
+    std::unordered_map<int, int> byNoradId_;         ///< catalog index per NORAD catalog number
+    std::unordered_map<unsigned long, int> byId_;    ///< catalog index per satellite id
+
+    void add( const std::string &hdr, const std::string &line1, const std::string &line2 );
+};
+
+#endif  // VIESCHEDPP_SATELLITECATALOG_H
@@ -0,0 +1,105 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "SatelliteCoverageIndex.h"
+
+#include <algorithm>
+
+SatelliteCoverageIndex::SatelliteCoverageIndex( const std::vector<std::vector<SatelliteForGUI::SatPass>> &passList,
+                                                const DateTime &sessionStart, double duration )
+    : nSta_( passList.size() ), duration_( duration ), coverage_( passList.size() + 1, 0 ) {
+    struct Event {
+        double time;  ///< seconds since session start
+        int station;  ///< station index
+        int delta;    ///< +1 start of pass, -1 end of pass
+    };
+    std::vector<Event> events;
+    for ( std::size_t ista = 0; ista < passList.size(); ++ista ) {
+        for ( const auto &pass : passList[ista] ) {
+            double start = std::max( 0.0, ( pass.start - sessionStart ).TotalSeconds() );
+            double end = std::min( duration, ( pass.end - sessionStart ).TotalSeconds() );
+            if ( end > start ) {
+                events.push_back( Event{start, static_cast<int>( ista ), 1} );
+                events.push_back( Event{end, static_cast<int>( ista ), -1} );
+            }
+        }
+    }
+    std::sort( events.begin(), events.end(), []( const Event &a, const Event &b ) { return a.time < b.time; } );
+
+    // sweep, all events at the same time are applied together so that touching passes do not overlap
+    std::vector<int> active( nSta_, 0 );
+    auto addSegment = [&]( double start, double end ) {
+        if ( end <= start ) {
+            return;
+        }
+        segmentStart_.push_back( start );
+        offset_.push_back( stations_.size() );
+        for ( std::size_t ista = 0; ista < nSta_; ++ista ) {
+            if ( active[ista] > 0 ) {
+                stations_.push_back( static_cast<int>( ista ) );
+            }
+        }
+        coverage_[stations_.size() - offset_.back()] += end - start;
+    };
+
+    double t = 0;
+    std::size_t i = 0;
+    while ( i < events.size() ) {
+        double time = events[i].time;
+        addSegment( t, time );
+        while ( i < events.size() && events[i].time == time ) {
+            active[events[i].station] += events[i].delta;
+            ++i;
+        }
+        t = std::max( t, time );
+    }
+    addSegment( t, duration );
+    offset_.push_back( stations_.size() );
+
+    coverageAtLeast_.assign( coverage_.size(), 0 );
+    double sum = 0;
+    for ( std::size_t k = coverage_.size(); k-- > 0; ) {
+        sum += coverage_[k];
+        coverageAtLeast_[k] = sum;
+    }
+}
+
+int SatelliteCoverageIndex::findSegment( double t ) const {
+    if ( t < 0 || t >= duration_ || segmentStart_.empty() ) {
+        return -1;
+    }
+    auto it = std::upper_bound( segmentStart_.begin(), segmentStart_.end(), t );
+    return static_cast<int>( it - segmentStart_.begin() ) - 1;
+}
+
+std::vector<int> SatelliteCoverageIndex::getStationsAt( double t ) const {
+    int i = findSegment( t );
+    if ( i == -1 ) {
+        return {};
+    }
+    return std::vector<int>( stations_.begin() + offset_[i], stations_.begin() + offset_[i + 1] );
+}
+
+int SatelliteCoverageIndex::getNumberOfStationsAt( double t ) const {
+    int i = findSegment( t );
+    if ( i == -1 ) {
+        return 0;
+    }
+    return static_cast<int>( offset_[i + 1] - offset_[i] );
+}
@@ -0,0 +1,107 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef VIESCHEDPP_SATELLITECOVERAGEINDEX_H
+#define VIESCHEDPP_SATELLITECOVERAGEINDEX_H
+
+#include <vector>
+#include "SatelliteForGUI.h"
+
+/**
+ * @brief interval coverage of the passes of one satellite over all stations
+ *
+ * The passes are swept once and the session is split into segments in which the set of stations that see the
+ * satellite does not change. The stations visible at a time are found with a binary search over the segment starts,
+ * the time covered by exactly (or at least) k stations is precomputed.
+ *
+ * All times are seconds since session start, passes are clipped to the session.
+ */
+class SatelliteCoverageIndex {
+   public:
+    SatelliteCoverageIndex() = default;
+
+    /**
+     * @brief constructor
+     *
+     * @param passList passes of one satellite [station][pass]
+     * @param sessionStart session start
+     * @param duration session duration [s]
+     */
+    SatelliteCoverageIndex( const std::vector<std::vector<SatelliteForGUI::SatPass>> &passList,
+                            const DateTime &sessionStart, double duration );
+
+    /**
+     * @brief number of stations
+     *
+     * @return number of stations
+     */
+    std::size_t getNSta() const noexcept { return nSta_; }
+
+    /**
+     * @brief stations which see the satellite
+     *
+     * @param t seconds since session start
+     * @return station indices (same order as the pass list)
+     */
+    std::vector<int> getStationsAt( double t ) const;
+
+    /**
+     * @brief number of stations which see the satellite
+     *
+     * @param t seconds since session start
+     * @return number of stations
+     */
+    int getNumberOfStationsAt( double t ) const;
+
+    /**
+     * @brief time in which exactly k stations see the satellite
+     *
+     * @param k number of stations
+     * @return time [s], for k = 0 this includes the time in which no pass was found
+     */
+    double getCoverage( std::size_t k ) const { return k < coverage_.size() ? coverage_[k] : 0; }
+
+    /**
+     * @brief time in which at least k stations see the satellite
+     *
+     * @param k number of stations
+     * @return time [s]
+     */
+    double getCoverageAtLeast( std::size_t k ) const { return k < coverageAtLeast_.size() ? coverageAtLeast_[k] : 0; }
+
+    /**
+     * @brief time in which exactly k stations see the satellite for all k
+     *
+     * @return time [s] per number of stations (0 ... getNSta())
+     */
+    const std::vector<double> &getCoveragePerNSta() const noexcept { return coverage_; }
+
+   private:
+    std::size_t nSta_ = 0;                 ///< number of stations
+    double duration_ = 0;                  ///< session duration [s]
+    std::vector<double> segmentStart_;     ///< start of segment [s], the segment ends at the next start
+    std::vector<std::size_t> offset_;      ///< stations of segment i are stations_[offset_[i]] ... [offset_[i+1]-1]
+    std::vector<int> stations_;            ///< station indices of all segments
+    std::vector<double> coverage_;         ///< time with exactly k stations [s]
+    std::vector<double> coverageAtLeast_;  ///< time with at least k stations [s]
+
+    int findSegment( double t ) const;
+};
+
+#endif  // VIESCHEDPP_SATELLITECOVERAGEINDEX_H
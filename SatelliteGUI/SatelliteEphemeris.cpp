@@ -0,0 +1,88 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SatelliteEphemeris.h"
+
+#include <cmath>
+
+SatelliteEphemeris::SatelliteEphemeris( const Tle &tle, const DateTime &start, unsigned int duration, unsigned int step )
+    : tle_( tle ), start_( start ), step_( step == 0 ? 1 : step ) {
+    nNodes_ = static_cast<int>( duration / step_ ) + 2;  // one node past the end
+    pos_.resize( 3 * nNodes_ );
+    vel_.resize( 3 * nNodes_ );
+    valid_.resize( nNodes_, 0 );
+
+    // SGP4 keeps deep space integrator state, every thread needs its own propagator
+    #pragma omp parallel
+    {
+        SGP4 sgp4( tle_ );
+        #pragma omp for schedule(static)
+        for ( int i = 0; i < nNodes_; ++i ) {
+            try {
+                Eci eci = sgp4.FindPosition( start_.AddSeconds( static_cast<double>( i ) * step_ ) );
+                pos_[3 * i] = eci.Position().x;
+                pos_[3 * i + 1] = eci.Position().y;
+                pos_[3 * i + 2] = eci.Position().z;
+                vel_[3 * i] = eci.Velocity().x;
+                vel_[3 * i + 1] = eci.Velocity().y;
+                vel_[3 * i + 2] = eci.Velocity().z;
+                valid_[i] = 1;
+            } catch ( ... ) {
+                // decayed satellite etc., FindPosition will propagate directly and report the error
+                valid_[i] = 0;
+            }
+        }
+    }
+}
+
+Eci SatelliteEphemeris::FindPosition( const DateTime &time ) const {
+    double seconds = ( time - start_ ).TotalSeconds();
+    double h = static_cast<double>( step_ );
+    int i = static_cast<int>( std::floor( seconds / h ) );
+    if ( seconds < 0 || i + 1 >= nNodes_ || !valid_[i] || !valid_[i + 1] ) {
+        SGP4 sgp4( tle_ );
+        return sgp4.FindPosition( time );
+    }
+
+    // cubic Hermite basis on [0, 1]
+    double s = ( seconds - i * h ) / h;
+    double s2 = s * s;
+    double s3 = s2 * s;
+    double h00 = 2 * s3 - 3 * s2 + 1;
+    double h10 = s3 - 2 * s2 + s;
+    double h01 = -2 * s3 + 3 * s2;
+    double h11 = s3 - s2;
+    // derivatives with respect to s
+    double d00 = 6 * s2 - 6 * s;
+    double d10 = 3 * s2 - 4 * s + 1;
+    double d01 = -6 * s2 + 6 * s;
+    double d11 = 3 * s2 - 2 * s;
+
+    const double *p0 = &pos_[3 * i];
+    const double *p1 = &pos_[3 * i + 3];
+    const double *v0 = &vel_[3 * i];
+    const double *v1 = &vel_[3 * i + 3];
+
+    double p[3];
+    double v[3];
+    for ( int k = 0; k < 3; ++k ) {
+        p[k] = h00 * p0[k] + h10 * h * v0[k] + h01 * p1[k] + h11 * h * v1[k];
+        v[k] = ( d00 * p0[k] + d01 * p1[k] ) / h + d10 * v0[k] + d11 * v1[k];
+    }
+    return Eci( time, Vector( p[0], p[1], p[2] ), Vector( v[0], v[1], v[2] ) );
+}
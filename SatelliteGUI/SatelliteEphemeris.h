@@ -0,0 +1,75 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIESCHEDPP_SATELLITEEPHEMERIS_H
+#define VIESCHEDPP_SATELLITEEPHEMERIS_H
+
+#include <vector>
+#include "../VieSchedpp/SGP4/DateTime.h"
+#include "../VieSchedpp/SGP4/Eci.h"
+#include "../VieSchedpp/SGP4/SGP4.h"
+#include "../VieSchedpp/SGP4/Tle.h"
+
+/**
+ * @brief ECI position and velocity of one satellite on a fixed grid over the session
+ *
+ * The satellite position does not depend on the station, therefore SGP4 is evaluated once per grid node (in parallel)
+ * and all look angle computations interpolate between the nodes with a cubic Hermite polynomial built from position
+ * and velocity. With the default step of 60 s the interpolation error is below one meter even for low earth orbiters
+ * and far below that for GNSS orbits, which is negligible compared to the SGP4 accuracy itself.
+ *
+ * Queries outside of the grid (or next to a node where SGP4 failed) are propagated directly with SGP4.
+ */
+class SatelliteEphemeris {
+   public:
+    /**
+     * @brief constructor
+     *
+     * @param tle satellite TLE data
+     * @param start start of grid
+     * @param duration length of grid in seconds
+     * @param step grid step in seconds
+     */
+    SatelliteEphemeris( const Tle &tle, const DateTime &start, unsigned int duration, unsigned int step = 60 );
+
+    /**
+     * @brief interpolated satellite position and velocity
+     *
+     * @param time epoch
+     * @return satellite position and velocity in earth centered inertial system
+     */
+    Eci FindPosition( const DateTime &time ) const;
+
+    /**
+     * @brief getter for grid step
+     *
+     * @return grid step in seconds
+     */
+    unsigned int getStep() const noexcept { return step_; }
+
+   private:
+    Tle tle_;                   ///< TLE data, used for direct propagation outside of the grid
+    DateTime start_;            ///< epoch of first node
+    unsigned int step_;         ///< grid step in seconds
+    int nNodes_;                ///< number of nodes
+    std::vector<double> pos_;   ///< position [km] of node i at 3*i, 3*i+1, 3*i+2
+    std::vector<double> vel_;   ///< velocity [km/s] of node i at 3*i, 3*i+1, 3*i+2
+    std::vector<char> valid_;   ///< false if SGP4 failed at node i
+};
+
+#endif  // VIESCHEDPP_SATELLITEEPHEMERIS_H
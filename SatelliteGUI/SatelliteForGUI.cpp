@@ -24,9 +24,226 @@
  */
 
 #include "SatelliteForGUI.h"
+#include "SatelliteCatalog.h"
+#include "../VieSchedpp/SGP4/Globals.h"
+#include "../VieSchedpp/SGP4/OrbitalElements.h"
+#include "../VieSchedpp/Station/Antenna/Antenna_HaDc.h"
+#include "../VieSchedpp/Station/Antenna/Antenna_XYew.h"
+#include <algorithm>
+#include <array>
+#include <limits>
 
 using namespace std;
 unsigned long SatelliteForGUI::nextId = 0;
+unsigned int SatelliteForGUI::sunGridStep_ = 1800;
+double SatelliteForGUI::crossingTolerance_ = 0.0001;
+double SatelliteForGUI::minimumSearchStep_ = 1.0;
+
+namespace {
+    // sun azimuth/elevation per station name, valid for one session and grid step
+    std::mutex sunCacheMutex;
+    double sunCacheMjdStart = -1;
+    unsigned int sunCacheDuration = 0;
+    unsigned int sunCacheStep = 0;
+    std::map<std::string, std::shared_ptr<const SatelliteForGUI::SunTable>> sunCache;
+
+    // ephemeris grid per TLE, valid for one session
+    struct EphemerisEntry {
+        std::once_flag built;
+        std::shared_ptr<const SatelliteEphemeris> ephemeris;
+    };
+    std::mutex ephemerisCacheMutex;
+    double ephemerisCacheMjdStart = -1;
+    unsigned int ephemerisCacheDuration = 0;
+    std::map<std::string, std::shared_ptr<EphemerisEntry>> ephemerisCache;
+
+    // earth rotation rate [rad/s]
+    const double earthRotation = 7.292115e-5;
+
+    // smallest topocentric range [km] to a satellite with geocentric radius >= rSat seen below elevation el
+    double minRange( double rSat, double rSta, double el ) {
+        double c = rSta * cos( el );
+        if ( rSat <= c ) {
+            return 0;
+        }
+        return -rSta * sin( el ) + sqrt( rSat * rSat - c * c );
+    }
+
+    // sampling step of the tracking check in seconds, sign changes of the violation are refined by root finding
+    const double trackingCheckStep = 10;
+
+    // axes of the antenna mount
+    enum class Mount {
+        azel,  // azimuth and elevation
+        hadc,  // hour angle and declination
+        xyew,  // X (east-west) and Y
+    };
+
+    Mount mountType( const VieVS::AbstractAntenna &antenna ) {
+        if ( dynamic_cast<const VieVS::Antenna_HaDc *>( &antenna ) != nullptr ) {
+            return Mount::hadc;
+        }
+        if ( dynamic_cast<const VieVS::Antenna_XYew *>( &antenna ) != nullptr ) {
+            return Mount::xyew;
+        }
+        return Mount::azel;
+    }
+
+    // look angles and axis rates of the mount
+    struct TrackingState {
+        double az;     // azimuth [rad]
+        double el;     // elevation [rad]
+        double rate1;  // rate of first axis [rad/s]
+        double rate2;  // rate of second axis [rad/s]
+    };
+
+    // time derivatives of atan2(x[1], x[0]) and asin(x[2] / |x|) for vector x with derivative v
+    void angleRates( const double x[3], const double v[3], double &rate1, double &rate2 ) {
+        double h2 = x[0] * x[0] + x[1] * x[1];
+        if ( h2 == 0 ) {
+            // first axis is undefined at the pole of the mount
+            rate1 = std::numeric_limits<double>::max();
+            rate2 = 0;
+            return;
+        }
+        double rho = sqrt( h2 + x[2] * x[2] );
+        double rhoRate = ( x[0] * v[0] + x[1] * v[1] + x[2] * v[2] ) / rho;
+        rate1 = ( x[0] * v[1] - x[1] * v[0] ) / h2;
+        rate2 = ( v[2] - rhoRate * x[2] / rho ) / sqrt( h2 );
+    }
+
+    /*
+     * look angles from the topocentric range vector (same definition as Observer::GetLookAngle), its derivative in the
+     * earth fixed frame gives the axis rates
+     */
+    TrackingState trackingState( const Observer &obs, const Eci &eci, Mount mount ) {
+        const CoordGeodetic &geo = obs.GetLocation();
+        Eci site( eci.GetDateTime(), geo );
+        Vector range = eci.Position() - site.Position();
+        Vector rangeRate = eci.Velocity() - site.Velocity();
+        // remove the rotation of the topocentric frame
+        double vx = rangeRate.x + earthRotation * range.y;
+        double vy = rangeRate.y - earthRotation * range.x;
+        double vz = rangeRate.z;
+
+        double theta = eci.GetDateTime().ToLocalMeanSiderealTime( geo.longitude );
+        double sinLat = sin( geo.latitude );
+        double cosLat = cos( geo.latitude );
+        double sinTheta = sin( theta );
+        double cosTheta = cos( theta );
+        // north, east, up
+        double n = -( sinLat * cosTheta * range.x + sinLat * sinTheta * range.y - cosLat * range.z );
+        double e = -sinTheta * range.x + cosTheta * range.y;
+        double u = cosLat * cosTheta * range.x + cosLat * sinTheta * range.y + sinLat * range.z;
+        double nRate = -( sinLat * cosTheta * vx + sinLat * sinTheta * vy - cosLat * vz );
+        double eRate = -sinTheta * vx + cosTheta * vy;
+        double uRate = cosLat * cosTheta * vx + cosLat * sinTheta * vy + sinLat * vz;
+
+        TrackingState state;
+        state.az = atan2( e, n );
+        if ( state.az < 0 ) {
+            state.az += twopi;
+        }
+        state.el = asin( u / sqrt( n * n + e * e + u * u ) );
+
+        double x[3];
+        double v[3];
+        switch ( mount ) {
+            case Mount::azel: {
+                x[0] = n, x[1] = e, x[2] = u;
+                v[0] = nRate, v[1] = eRate, v[2] = uRate;
+                break;
+            }
+            case Mount::hadc: {
+                x[0] = cosLat * u - sinLat * n, x[1] = -e, x[2] = sinLat * u + cosLat * n;
+                v[0] = cosLat * uRate - sinLat * nRate, v[1] = -eRate, v[2] = sinLat * uRate + cosLat * nRate;
+                break;
+            }
+            case Mount::xyew: {
+                x[0] = u, x[1] = n, x[2] = e;
+                v[0] = uRate, v[1] = nRate, v[2] = eRate;
+                break;
+            }
+        }
+        angleRates( x, v, state.rate1, state.rate2 );
+        return state;
+    }
+
+    /*
+     * Illinois (modified regula falsi) for a sign change of f between a and b, the bracket is maintained with the sign
+     * so that kinks of f can not break it, bisection is used if the bracket did not halve within two iterations.
+     * Returns the end of the final bracket with f <= 0.
+     */
+    template <typename Function>
+    double findSignChange( const Function &f, double a, double fa, double b, double fb, double tolerance ) {
+        bool rising = fa <= 0;
+        int side = 0;
+        int slow = 0;
+        double width = b - a;
+        while ( b - a > tolerance ) {
+            double t = 0.5 * ( a + b );
+            if ( slow < 2 ) {
+                double secant = b - fb * ( b - a ) / ( fb - fa );
+                double guard = 0.25 * tolerance;
+                if ( secant > a + guard && secant < b - guard ) {
+                    t = secant;
+                }
+            }
+
+            double ft = f( t );
+            if ( ( ft <= 0 ) == rising ) {
+                a = t;
+                fa = ft;
+                if ( side == 1 ) {
+                    fb *= 0.5;
+                }
+                side = 1;
+            } else {
+                b = t;
+                fb = ft;
+                if ( side == -1 ) {
+                    fa *= 0.5;
+                }
+                side = -1;
+            }
+
+            slow = b - a > 0.5 * width ? slow + 1 : 0;
+            if ( slow == 0 ) {
+                width = b - a;
+            }
+        }
+        return rising ? a : b;
+    }
+
+    /*
+     * golden section search for the maximum of f in [a, b], f is assumed to be unimodal in the interval.
+     * Returns the position of the maximum.
+     */
+    template <typename Function>
+    double findMaximum( const Function &f, double a, double b, double tolerance ) {
+        const double ratio = 0.5 * ( sqrt( 5.0 ) - 1 );
+        double c = b - ratio * ( b - a );
+        double d = a + ratio * ( b - a );
+        double fc = f( c );
+        double fd = f( d );
+        while ( b - a > tolerance ) {
+            if ( fc >= fd ) {
+                b = d;
+                d = c;
+                fd = fc;
+                c = b - ratio * ( b - a );
+                fc = f( c );
+            } else {
+                a = c;
+                c = d;
+                fc = fd;
+                d = a + ratio * ( b - a );
+                fd = f( d );
+            }
+        }
+        return 0.5 * ( a + b );
+    }
+}
 
 SatelliteForGUI::SatelliteForGUI()
     : header_( "" ), line1_( "" ), line2_( "" ), VieVS_NamedObject::VieVS_NamedObject( "", "", nextId++ ) {
@@ -38,7 +255,7 @@ SatelliteForGUI::SatelliteForGUI()
 SatelliteForGUI::SatelliteForGUI( std::string hdr, std::string l1, std::string l2 )
     : header_( hdr ), line1_( l1 ), line2_( l2 ), VieVS_NamedObject::VieVS_NamedObject( hdr, hdr, nextId++ ) {
     pTleData_ = new Tle( hdr, l1, l2 );
-    pSGP4Data_ = new SGP4( *pTleData_ );
+    pSGP4Data_ = nullptr;  // created on first use, positions are computed from the ephemeris grid
 }
 
 
@@ -53,7 +270,39 @@ const std::string SatelliteForGUI::getLine1() const noexcept { return this->line
 
 const std::string SatelliteForGUI::getLine2() const noexcept { return this->line2_; }
 
-SGP4* SatelliteForGUI::getSGP4Data() { return this->pSGP4Data_; }
+SGP4* SatelliteForGUI::getSGP4Data() {
+    if ( pSGP4Data_ == nullptr && pTleData_ != nullptr ) {
+        pSGP4Data_ = new SGP4( *pTleData_ );
+    }
+    return this->pSGP4Data_;
+}
+
+std::shared_ptr<const SatelliteEphemeris> SatelliteForGUI::getEphemeris() const {
+    std::shared_ptr<EphemerisEntry> entry;
+    {
+        std::lock_guard<std::mutex> lock( ephemerisCacheMutex );
+        if ( ephemerisCacheMjdStart != VieVS::TimeSystem::mjdStart ||
+             ephemerisCacheDuration != VieVS::TimeSystem::duration ) {
+            ephemerisCache.clear();
+            ephemerisCacheMjdStart = VieVS::TimeSystem::mjdStart;
+            ephemerisCacheDuration = VieVS::TimeSystem::duration;
+        }
+        auto &e = ephemerisCache[line1_ + line2_];
+        if ( !e ) {
+            e = std::make_shared<EphemerisEntry>();
+        }
+        entry = e;
+    }
+
+    // build outside of the cache lock, other threads asking for the same satellite wait here
+    std::call_once( entry->built, [&]() {
+        const auto &st = VieVS::TimeSystem::startTime;
+        DateTime start( st.date().year(), st.date().month(), st.date().day(), st.time_of_day().hours(),
+                        st.time_of_day().minutes(), st.time_of_day().seconds() );
+        entry->ephemeris = std::make_shared<const SatelliteEphemeris>( *pTleData_, start, VieVS::TimeSystem::duration );
+    } );
+    return entry->ephemeris;
+}
 
 /* This function calculates the ra and dec and ha for the satellite to the given current time and sets the variables in
  * the pointing vector
@@ -101,175 +350,166 @@ void SatelliteForGUI::calcRaDeHa( DateTime current_time, DateTime start_time, Ec
     pv->setDc( dec );
 }
 
-double SatelliteForGUI::getSunDistance(DateTime current_time, VieVS::Station station, std::vector<std::vector<double>> AzElSun, DateTime sessionStartTime) const
+void SatelliteForGUI::SunTable::azel( double seconds, double &az_sun, double &el_sun ) const
 {
-    double seconds = (current_time - sessionStartTime).TotalSeconds();
-    int i =0;
-    for(i; i< AzElSun.size();i++) {
-        std::vector<double> it = AzElSun.at(i);
-        if(seconds == it.at(0))
-        {
-            break;
+    if ( az.size() < 2 ) {
+        az_sun = az.empty() ? 0 : az[0];
+        el_sun = el.empty() ? 0 : el[0];
+        return;
+    }
+    // direct index, the last interval is extrapolated if the session end is not on the grid
+    long i = static_cast<long>( std::floor( seconds / step ) );
+    i = std::max( 0L, std::min( static_cast<long>( az.size() ) - 2, i ) );
+    double factor = ( seconds - static_cast<double>( i * step ) ) / step;
+
+    double az1 = az[i];
+    double az2 = az[i + 1];
+    if ( abs( az1 - az2 ) > halfpi ) {
+        if ( az2 > az1 ) {
+            az1 += twopi;
         }
-        if(seconds<it.at(0)) {
-            i = i-1;
-            break;
+        if ( az1 > az2 ) {
+            az2 += twopi;
         }
     }
-    double factor = (seconds-AzElSun[i][0]) / (AzElSun[i+1][0] - AzElSun[i][0]);
-
-    double az1 = AzElSun[i][1];
-    double az2 = AzElSun[i+1][1];
-    if(abs(az1-az2)>halfpi) {
-               if(az2 > az1) {
-                   az1 += twopi;
-               }
-               if(az1 > az2) {
-                   az2 += twopi;
-               }
-           }
-           double az_sun = az1 + factor * (az2-az1);
-           if(az_sun > twopi) {
-               az_sun -= twopi;
-           }
-
-    double el_sun = AzElSun[i][2] + factor * (AzElSun[i+1][2] - AzElSun[i][2]);
+    az_sun = az1 + factor * ( az2 - az1 );
+    if ( az_sun > twopi ) {
+        az_sun -= twopi;
+    }
+    el_sun = el[i] + factor * ( el[i + 1] - el[i] );
+}
 
-    SGP4* sgp4( this->pSGP4Data_ );
-    Eci eci = sgp4->FindPosition( current_time );
-    CoordGeodetic user_geo( station.getPosition()->getLat(), station.getPosition()->getLon(),
-                            station.getPosition()->getAltitude() / 1000, true );
-    Observer obs( user_geo );
-    CoordTopocentric topo = obs.GetLookAngle( eci );
-    double az_sat = topo.azimuth;
-    double el_sat = topo.elevation;
-
-    std::vector<double> v_src = {cos(el_sat)*cos(az_sat),cos(el_sat)*sin(az_sat),sin(el_sat)}; // Unity vector station-source
-    std::vector<double> v_sun = {cos(el_sun)*cos(az_sun),cos(el_sun)*sin(az_sun),sin(el_sun)}; // Unity vector station-sun
-    double sun_dist = acos(v_src[0]*v_sun[0] + v_src[1] * v_sun[1] + v_src[2] * v_sun[2]);
-    //std::cout << seconds/60 << " " << sun_dist * 180/pi << " " << az_sun*180/pi << " " << el_sun*180/pi << " " << az_sat*180/pi << " " << el_sat*180/pi << std::endl;
-    return sun_dist;
+double SatelliteForGUI::getSunDistance( double seconds, double az_sat, double el_sat, const SunTable &sun )
+{
+    double az_sun;
+    double el_sun;
+    sun.azel( seconds, az_sun, el_sun );
+
+    double cel_sat = cos( el_sat );
+    double cel_sun = cos( el_sun );
+    // dot product of unit vectors station-source and station-sun
+    double d = cel_sat * cos( az_sat ) * cel_sun * cos( az_sun ) + cel_sat * sin( az_sat ) * cel_sun * sin( az_sun ) +
+               sin( el_sat ) * sin( el_sun );
+    return acos( std::max( -1.0, std::min( 1.0, d ) ) );
 }
 
 /*
- * This function checks the found satellite passes concerning the slew rates of the atennas and the distance between the sun and the to observing satelllite.
- * If the slew rates are exceeded or the satellite is too close too close at the sun the satellite pass will
- * be ended. The checking will be contued for the rest of the satellite scan. So it can happen that one satelite pass will be splitted in two passede because
- * the antenna slew rates are exceeded or the sun distance is too small.
+ * This function checks the found satellite passes concerning the slew rates of the antenna and the distance between
+ * the sun and the satellite. Parts of the pass in which the axis rates of the mount exceed the slew rates of the
+ * antenna or the satellite is too close to the sun are removed, so it can happen that one satellite pass will be
+ * split into several passes.
+ *
+ * The axis rates are computed analytically from the ephemeris velocity. Both conditions are combined into one
+ * continuous violation function, it is sampled every trackingCheckStep seconds and each change of its sign is refined
+ * by root finding. Near the pole of the mount (e.g. a LEO passing close to the zenith of an AzEl antenna) an axis rate
+ * can exceed its limit for less than one sampling step. Therefore the maximum of each axis rate is searched between
+ * the samples around every local maximum of the sampled rate, a violated maximum is added as additional sample.
  */
-std::vector<SatelliteForGUI::SatPass> SatelliteForGUI::checkSatPass( struct SatPass satPass, DateTime sessionStartTime, SGP4 &sgp4_old, VieVS::Station station, std::vector<std::vector<double>> AzElSun) const
+std::vector<SatelliteForGUI::SatPass> SatelliteForGUI::checkSatPass( struct SatPass satPass, DateTime sessionStartTime, const SatelliteEphemeris &eph, VieVS::Station station, const SunTable &sun) const
 {
-    //std::cout << station.getName() << std::endl;
     double minSunDistance = 4 * deg2rad;   ///< minimum sun distance in radians
-    bool hasStarted = false;
-    DateTime current_time = satPass.start;  
-    
+    const VieVS::AbstractAntenna &antenna = station.getAntenna();
+    Mount mount = mountType( antenna );
+    double rateLimits[2] = {antenna.getRate1(), antenna.getRate2()};
+
     CoordGeodetic user_geo( station.getPosition()->getLat(), station.getPosition()->getLon(),
                             station.getPosition()->getAltitude() / 1000, true );
     Observer obs( user_geo );
 
-    //find Pointing Vector at the start time
-    SGP4 *sgp4 = this->pSGP4Data_;
-    Eci eci = sgp4->FindPosition( current_time );
-    CoordTopocentric topo = obs.GetLookAngle( eci );
-    VieVS::PointingVector pv_old = VieVS::PointingVector( 1, 0 );
-    pv_old.setAz( topo.azimuth );
-    pv_old.setEl( topo.elevation );
-    SatelliteForGUI::calcRaDeHa( current_time, sessionStartTime, eci, obs, &pv_old );
-
-    current_time = current_time + TimeSpan( 0, 0, 10 );
-    
-    struct SatPass satPasschecked;
-    std::vector<struct SatPass> checkedSatPasses;
+    // terms of the violation t seconds after the start of the pass: sun distance, rate of first and second axis
+    auto terms = [&]( double t ) {
+        DateTime time = satPass.start.AddSeconds( t );
+        TrackingState state = trackingState( obs, eph.FindPosition( time ), mount );
+        std::array<double, 3> term;
+        term[0] = ( minSunDistance -
+                    getSunDistance( ( time - sessionStartTime ).TotalSeconds(), state.az, state.el, sun ) ) /
+                  minSunDistance;
+        term[1] = rateLimits[0] > 0 ? std::abs( state.rate1 ) / rateLimits[0] - 1 : -1;
+        term[2] = rateLimits[1] > 0 ? std::abs( state.rate2 ) / rateLimits[1] - 1 : -1;
+        return term;
+    };
+    // positive if the axis rates or the sun distance are violated
+    auto combine = []( const std::array<double, 3> &term ) { return std::max( {term[0], term[1], term[2]} ); };
+    auto violation = [&]( double t ) { return combine( terms( t ) ); };
+
+    double duration = ( satPass.end - satPass.start ).TotalSeconds();
+    std::vector<double> times;
+    std::vector<std::array<double, 3>> samples;
+    for ( double t = 0;; t = std::min( t + trackingCheckStep, duration ) ) {
+        times.push_back( t );
+        samples.push_back( terms( t ) );
+        if ( t >= duration ) {
+            break;
+        }
+    }
 
-    while(current_time < (satPass.end+ TimeSpan( 0, 0, 10 )))
-    {
-       double sunDistance = this->getSunDistance(current_time - TimeSpan(0,0,10), station, AzElSun, sessionStartTime);
-       //std::cout << current_time<< "  " << sunDistance << "  " << minSunDistance << std::endl;
-       Eci eci = sgp4->FindPosition( current_time );
-       CoordTopocentric topo = obs.GetLookAngle( eci );
-       VieVS::PointingVector pv_new = VieVS::PointingVector( 1, 0 );
-       pv_new.setAz( topo.azimuth );
-       pv_new.setEl( topo.elevation );
-       SatelliteForGUI::calcRaDeHa( current_time, sessionStartTime, eci, obs, &pv_new );
-
-       station.getCableWrap().calcUnwrappedAz(pv_old,pv_new);
-       unsigned int Slewtime = station.getAntenna().slewTimeTracking(pv_old, pv_new);
-       if(Slewtime < 10 && !hasStarted && sunDistance > minSunDistance) //set the start
-       {
-            satPasschecked.start = current_time - TimeSpan( 0, 0, 10);
-            satPasschecked.stationID = satPass.stationID;
-            satPasschecked.satelliteID = satPass.satelliteID;
-            hasStarted = true;
-       }
-       else if(Slewtime>10 && hasStarted ) //set the end and append
-       {
-           //std::cout << current_time <<" "<< station.getName() << std::endl;
-           //std::cout << pv_old.getAz()*180/pi << " "<< pv_old.getEl()*180/pi << std::endl;
-           //std::cout << pv_new.getAz()*180/pi << " "<< pv_new.getEl()*180/pi << std::endl;
-           //unsigned int Slewtime = station.getAntenna().slewTime(pv_old, pv_new);
-
-           DateTime t = current_time;
-           current_time = current_time - TimeSpan(0,0,10);
-           while(current_time<t) {
-               current_time = current_time + TimeSpan(0,0,1);
-               Eci eci = sgp4->FindPosition( current_time );
-               CoordTopocentric topo = obs.GetLookAngle( eci );
-               VieVS::PointingVector pv_new = VieVS::PointingVector( 1, 0 );
-               pv_new.setAz( topo.azimuth );
-               pv_new.setEl( topo.elevation );
-               SatelliteForGUI::calcRaDeHa( t, sessionStartTime, eci, obs, &pv_new );
-
-               station.getCableWrap().calcUnwrappedAz(pv_old,pv_new);
-               unsigned int Slewtime = station.getAntenna().slewTimeTracking(pv_old, pv_new);
-               if(Slewtime>1) {
-                   //std::cout << current_time - TimeSpan(0,0,1) << " " << pv_old.getAz()*180/pi << " "<< pv_old.getEl()*180/pi << std::endl;
-                   //std::cout << current_time << " " << pv_new.getAz()*180/pi << " "<< pv_new.getEl()*180/pi << std::endl;
-                   break;
-               }
-               else {
-                   pv_old = pv_new;
-               }
-           }
-           satPasschecked.end = current_time - TimeSpan(0,0,1) ;
-           checkedSatPasses.push_back(satPasschecked);
-           hasStarted = false;
-       }
-       else if(sunDistance<minSunDistance && hasStarted){
-           DateTime t = current_time - TimeSpan(0,0,10);
-           current_time = current_time - TimeSpan(0,0,20);
-           while(current_time<t) {
-               current_time = current_time + TimeSpan(0,0,1);
-               double sunDistance = this->getSunDistance(current_time, station, AzElSun, sessionStartTime);
-               if(sunDistance<minSunDistance) {
-                   //std::cout << current_time - TimeSpan(0,0,1) << " " << pv_old.getAz()*180/pi << " "<< pv_old.getEl()*180/pi << std::endl;
-                   //std::cout << current_time << " " << pv_new.getAz()*180/pi << " "<< pv_new.getEl()*180/pi << std::endl;
-                   //std::cout << "SUN DISTANCE " << station.getName() << " " <<  sunDistance << " " << minSunDistance << std::endl;
-                   Eci eci = sgp4->FindPosition( current_time- TimeSpan(0,0,1) );
-                   CoordTopocentric topo = obs.GetLookAngle( eci );
-                   VieVS::PointingVector pv_new = VieVS::PointingVector( 1, 0 );
-                   pv_new.setAz( topo.azimuth );
-                   pv_new.setEl( topo.elevation );
-                   SatelliteForGUI::calcRaDeHa( current_time- TimeSpan(0,0,1), sessionStartTime, eci, obs, &pv_new );
-                   break;
-               }
-           }
-           satPasschecked.end = current_time - TimeSpan(0,0,1) ;
-           checkedSatPasses.push_back(satPasschecked);
-           hasStarted = false;
-       }
-       pv_old = pv_new; 
-       current_time = current_time + TimeSpan( 0, 0, 10 );
+    // violated rate maxima between the samples
+    std::vector<std::pair<double, double>> peaks;
+    int n = static_cast<int>( times.size() );
+    for ( int axis = 1; axis <= 2; ++axis ) {
+        if ( rateLimits[axis - 1] <= 0 ) {
+            continue;
+        }
+        for ( int k = 0; k < n; ++k ) {
+            int before = std::max( k - 1, 0 );
+            int after = std::min( k + 1, n - 1 );
+            if ( combine( samples[k] ) > 0 || samples[before][axis] > samples[k][axis] ||
+                 samples[after][axis] > samples[k][axis] || before == after ) {
+                continue;
+            }
+            double tPeak = findMaximum( [&]( double t ) { return terms( t )[axis]; }, times[before], times[after],
+                                        crossingTolerance_ );
+            double vPeak = violation( tPeak );
+            if ( vPeak > 0 ) {
+                peaks.emplace_back( tPeak, vPeak );
+            }
+        }
     }
-    if(current_time > satPass.end && hasStarted)
-    {
-        satPasschecked.end = satPass.end;
-        checkedSatPasses.push_back(satPasschecked);
+
+    std::vector<std::pair<double, double>> sampled;
+    sampled.reserve( times.size() + peaks.size() );
+    for ( int k = 0; k < n; ++k ) {
+        sampled.emplace_back( times[k], combine( samples[k] ) );
+    }
+    if ( !peaks.empty() ) {
+        sampled.insert( sampled.end(), peaks.begin(), peaks.end() );
+        std::sort( sampled.begin(), sampled.end() );
+    }
+
+    std::vector<struct SatPass> checkedSatPasses;
+    auto append = [&]( double start, double end ) {
+        struct SatPass satPasschecked;
+        satPasschecked.start = satPass.start.AddSeconds( start );
+        satPasschecked.end = end < 0 ? satPass.end : satPass.start.AddSeconds( end );
+        satPasschecked.stationID = satPass.stationID;
+        satPasschecked.satelliteID = satPass.satelliteID;
+        if ( satPasschecked.start < satPasschecked.end ) {
+            checkedSatPasses.push_back( satPasschecked );
+        }
+    };
+
+    double validStart = 0;  // start of the current valid interval
+    for ( std::size_t k = 1; k < sampled.size(); ++k ) {
+        double tPrev = sampled[k - 1].first;
+        double vPrev = sampled[k - 1].second;
+        double t = sampled[k].first;
+        double v = sampled[k].second;
+        if ( ( vPrev <= 0 ) != ( v <= 0 ) ) {
+            double change = findSignChange( violation, tPrev, vPrev, t, v, crossingTolerance_ );
+            if ( v > 0 ) {
+                append( validStart, change );
+            } else {
+                validStart = change;
+            }
+        }
+    }
+    if ( sampled.back().second <= 0 ) {
+        append( validStart, -1 );
     }
     return checkedSatPasses;
 }
 
-std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>> SatelliteForGUI::interpolateRaDecSun()
+std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>> SatelliteForGUI::interpolateRaDecSun( unsigned int step )
 {
     vector<unsigned int> reftimeSun = VieVS::AstronomicalParameters::sun_time;
     /*for(int j = 0; j<reftimeSun.size();j++)
@@ -314,7 +554,7 @@ std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>>
        raSun.push_back(ra);
        decSun.push_back(dec);
        //std::cout << secs << " " << ra*180/pi << " " <<  dec*180/pi << std::endl;
-       secs = secs + 1800;
+       secs = secs + step;
 
     }
     std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>> RaDecSun(timeSun,raSun, decSun);
@@ -322,11 +562,11 @@ std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>>
 }
 
 
-std::vector<std::vector<double>> SatelliteForGUI::azelSun(VieVS::Station station, DateTime startTime, DateTime endTime)
+std::vector<std::vector<double>> SatelliteForGUI::azelSun(VieVS::Station station, DateTime startTime, DateTime endTime, unsigned int step)
 {
     std::vector<std::vector<double>> AzElSun;
 
-    std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>> SunRaDec = SatelliteForGUI::interpolateRaDecSun();
+    std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>> SunRaDec = SatelliteForGUI::interpolateRaDecSun( step );
     vector<unsigned int> reftimeSun = get<0>(SunRaDec);
     std::vector<double> sun_ra = get<1>(SunRaDec);
     std::vector<double> sun_dec = get<2>(SunRaDec);
@@ -435,6 +675,67 @@ std::vector<std::vector<double>> SatelliteForGUI::azelSun(VieVS::Station station
     return AzElSun;
 }
 
+std::shared_ptr<const SatelliteForGUI::SunTable> SatelliteForGUI::azelSunCached( const VieVS::Station &station )
+{
+    {
+        std::lock_guard<std::mutex> lock( sunCacheMutex );
+        if ( sunCacheMjdStart != VieVS::TimeSystem::mjdStart || sunCacheDuration != VieVS::TimeSystem::duration ||
+             sunCacheStep != sunGridStep_ ) {
+            sunCache.clear();
+            sunCacheMjdStart = VieVS::TimeSystem::mjdStart;
+            sunCacheDuration = VieVS::TimeSystem::duration;
+            sunCacheStep = sunGridStep_;
+        }
+        auto it = sunCache.find( station.getName() );
+        if ( it != sunCache.end() ) {
+            return it->second;
+        }
+    }
+
+    // compute outside of the lock so that different stations can be computed in parallel
+    double mjdStart = VieVS::TimeSystem::mjdStart;
+    unsigned int duration = VieVS::TimeSystem::duration;
+    unsigned int step = sunGridStep_;
+    auto table = std::make_shared<SunTable>();
+    table->step = step;
+    for ( const auto &row : SatelliteForGUI::azelSun( station, DateTime(), DateTime(), step ) ) {
+        table->az.push_back( row[1] );
+        table->el.push_back( row[2] );
+    }
+
+    std::lock_guard<std::mutex> lock( sunCacheMutex );
+    if ( sunCacheMjdStart != mjdStart || sunCacheDuration != duration || sunCacheStep != step ) {
+        return table;
+    }
+    // another thread might have been faster, keep the first table so that everyone shares the same one
+    return sunCache.emplace( station.getName(), table ).first->second;
+}
+
+void SatelliteForGUI::setSunGridStep( unsigned int seconds )
+{
+    if ( seconds == 0 ) {
+        throw "grid step of sun table must be larger than 0";
+    }
+    std::lock_guard<std::mutex> lock( sunCacheMutex );
+    sunGridStep_ = seconds;
+}
+
+void SatelliteForGUI::setCrossingTolerance( double seconds )
+{
+    if ( seconds <= 0 ) {
+        throw "tolerance of horizon crossing must be larger than 0";
+    }
+    crossingTolerance_ = seconds;
+}
+
+void SatelliteForGUI::setMinimumSearchStep( double seconds )
+{
+    if ( seconds <= 0 ) {
+        throw "minimum step of pass search must be larger than 0";
+    }
+    minimumSearchStep_ = seconds;
+}
+
 //[Station][SatellitePasses]
 std::vector<std::vector<SatelliteForGUI::SatPass>> SatelliteForGUI::generatePassList( const VieVS::Network& network,
                                                                           const DateTime& start_time,
@@ -446,261 +747,242 @@ std::vector<std::vector<SatelliteForGUI::SatPass>> SatelliteForGUI::generatePass
     cout << "[info] start generating passlists for stations";
 #endif
     //[Station][SatellitePasses]
-    std::vector<std::vector<SatPass>> passList;
+    const std::vector<VieVS::Station> &stations = network.getStations();
+    int nsta = static_cast<int>( stations.size() );
+    std::vector<std::vector<SatPass>> passList( stations.size() );
+
+    // stations are independent, each result is written to its own slot so the order does not depend on the threads
+    #pragma omp parallel for schedule(dynamic)
+    for ( int i = 0; i < nsta; ++i ) {
+        passList[i] = generatePassList( stations[i], start_time, end_time, time_step );
+    }
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << "finish generating passlists for stations sucessfully";
+#else
+    cout << "[info] finish generating passlists for stations sucessfully";
+#endif
+    return passList;
+}
+
+std::vector<SatelliteForGUI::SatPass> SatelliteForGUI::generatePassList( const VieVS::Station& station,
+                                                                         const DateTime& start_time,
+                                                                         const DateTime& end_time,
+                                                                         const int time_step ) const {
+    // ephemeris and sun table are shared read-only, the observer is owned by this worker
+    std::shared_ptr<const SatelliteEphemeris> ephemeris = getEphemeris();
+    const SatelliteEphemeris &eph = *ephemeris;
+    std::shared_ptr<const SunTable> sun = SatelliteForGUI::azelSunCached( station );
     std::vector<SatPass> satellitePasses;
-    std::vector<VieVS::Station> stations = network.getStations();
-    for ( const auto& station : stations ) {
-        std::vector<std::vector<double>> azelSun = SatelliteForGUI::azelSun(station, start_time, end_time);
-        satellitePasses.clear();
-        CoordGeodetic user_geo( station.getPosition()->getLat(), station.getPosition()->getLon(),
-                                station.getPosition()->getAltitude() / 1000, true );
-        Observer obs( user_geo );
-        SGP4* sgp4( this->pSGP4Data_ );
-        DateTime aos_time;
-        DateTime los_time;
-        bool found_aos = false;
-
-        DateTime previous_time( start_time );
-        DateTime current_time( start_time );
-        //std::cout << endl;
-        //std::cout << station.getName() << std::endl ;
-        while ( current_time < end_time ) {
-            bool end_of_pass = false;
-            /*
-             * calculate satellite position
-             */
-            Eci eci = sgp4->FindPosition( current_time );
-            CoordTopocentric topo = obs.GetLookAngle( eci );
-            VieVS::PointingVector pv = VieVS::PointingVector( 1, 0 );
-            pv.setAz( topo.azimuth );
-            pv.setEl( topo.elevation );
-
-            if ( !found_aos && station.isVisible( pv, 0 )) {
-                /*
-                 * aos hasnt occured yet, but the satellite is now above horizon
-                 * this must have occured within the last time_step
-                 */
-                if ( start_time == current_time ) {
-                    /*
-                     * satellite was already above the horizon at the start,
-                     * so use the start time
-                     */
-                    aos_time = start_time;
-                } else {
-                    /*
-                     * find the point at which the satellite crossed the horizon
-                     */
-                    aos_time = findCrossingPoint( station, *sgp4, previous_time, current_time, true );
-                }
-                found_aos = true;
-            }
-            else if ( found_aos && !station.isVisible( pv, 0 ) ) {
-                found_aos = false;
-                /*
-                 * end of pass, so move along more than time_step
-                 */
-                end_of_pass = true;
-                /*
-                 * already have the aos, but now the satellite is below the horizon,
-                 * so find the los
-                 */
-                los_time = findCrossingPoint( station, *sgp4, previous_time, current_time, false );
-
-                struct SatPass pd;
-                pd.start = aos_time;
-                pd.end = los_time;
-                pd.stationID = station.getId();
-                pd.satelliteID = this->getId();
-
-                //std::cout << "Found Satellite Pass " << station.getName() << " " <<  this->getName() <<  std::endl;
-                //std::cout << "start: " << pd.start << std::endl;
-                //std::cout << "end: " << pd.end << std::endl << std::endl;
-
-                std::vector<SatelliteForGUI::SatPass> checkedSatPasses = this->checkSatPass(pd,start_time,*sgp4,station, azelSun);
-                //std::cout << "Checked Satellite Passes " << station.getName() << " " <<  this->getName() <<  std::endl;
-                for(auto const &satPass:checkedSatPasses){
-                    //std::cout << "start: " << satPass.start << std::endl;
-                    //std::cout << "end: " << satPass.end << std::endl << std::endl;
-                    satellitePasses.push_back( satPass );
-                }
-               // satellitePasses.push_back( pd );
-            }
+    CoordGeodetic user_geo( station.getPosition()->getLat(), station.getPosition()->getLon(),
+                            station.getPosition()->getAltitude() / 1000, true );
+    Observer obs( user_geo );
 
-            /*
-             * save current time
-             */
-            previous_time = current_time;
+    /*
+     * elevation band [elLow, elHigh] in which the visibility depends on minimum elevation and horizon mask,
+     * below the band the satellite is never visible, above it always
+     */
+    double minElevation = station.getPARA().minElevation;
+    double elLow = std::min( 0.0, minElevation );
+    double elHigh = std::max( 0.0, minElevation );
+    std::pair<std::vector<double>, std::vector<double>> mask = station.getHorizonMask();
+    for ( double el : mask.second ) {
+        elLow = std::min( elLow, el );
+        elHigh = std::max( elHigh, el );
+    }
 
-            if ( end_of_pass ) {
-                /*
-                 * at the end of the pass move the time along by 30mins
-                 */
-                current_time = current_time + TimeSpan( 0, 30, 0 );
-                //current_time = current_time + TimeSpan( 0, 0, time_step );
-            }
-            else
-            {
-                /*
-                 * move the time along by the time step value
-                 */
-                current_time = current_time + TimeSpan( 0, 0, time_step );
-            }
+    /*
+     * upper bound of the angular rate of the line of sight below, inside and above the band:
+     * maximum speed in the earth fixed frame / smallest possible topocentric range. The earth fixed speed is bounded
+     * by the inertial speed at perigee plus the speed of the rotating frame at apogee, which covers retrograde orbits
+     */
+    OrbitalElements elements( *pTleData_ );
+    double rSat = elements.Perigee() + kXKMPER - 25.0;  // margin for drag and short periodic perturbations
+    double rApogee = elements.Apogee() + kXKMPER + 25.0;
+    double a = elements.RecoveredSemiMajorAxis() * kXKMPER;
+    double rSta = std::sqrt( station.getPosition()->getX() * station.getPosition()->getX() +
+                             station.getPosition()->getY() * station.getPosition()->getY() +
+                             station.getPosition()->getZ() * station.getPosition()->getZ() ) / 1000;
+    double vMax = 1.05 * std::sqrt( kMU * std::max( 0.0, 2.0 / rSat - 1.0 / a ) ) + earthRotation * rApogee;
+    double rateLow = vMax / minRange( rSat, rSta, elLow );
+    double rateBand = vMax / minRange( rSat, rSta, elHigh );
+    double rateHigh = vMax / minRange( rSat, rSta, halfpi );
+
+    double tEnd = ( end_time - start_time ).TotalSeconds();
+    double t = 0;
+    double tPrev = 0;
+    double elPrev = 0;
+    bool visiblePrev = false;
+    DateTime aos_time;
+
+    while ( true ) {
+        /*
+         * calculate satellite position
+         */
+        DateTime current_time = start_time.AddSeconds( t );
+        Eci eci = eph.FindPosition( current_time );
+        CoordTopocentric topo = obs.GetLookAngle( eci );
+        VieVS::PointingVector pv = VieVS::PointingVector( 1, 0 );
+        pv.setAz( topo.azimuth );
+        pv.setEl( topo.elevation );
+        bool visible = station.isVisible( pv, 0 );
+        double el = topo.elevation;
 
-            if ( current_time > end_time ) {
+        if ( t == 0 ) {
+            if ( visible ) {
                 /*
-                 * dont go past end time
+                 * satellite was already above the horizon at the start, so use the start time
                  */
-                current_time = end_time;
+                aos_time = start_time;
             }
-        }
-
-        if ( found_aos ) {
-            /*
-             * satellite still above horizon at end of search period, so use end
-             * time as los
-             */
+        } else if ( visible && !visiblePrev ) {
+            aos_time = findCrossingPoint( station, eph, start_time.AddSeconds( tPrev ), current_time, true );
+        } else if ( !visible && visiblePrev ) {
             struct SatPass pd;
             pd.start = aos_time;
-            pd.end = end_time;
+            pd.end = findCrossingPoint( station, eph, start_time.AddSeconds( tPrev ), current_time, false );
             pd.stationID = station.getId();
             pd.satelliteID = this->getId();
-            std::vector<SatelliteForGUI::SatPass> checkedSatPasses = checkSatPass(pd,start_time,*sgp4,station,azelSun);
 
-            for(auto const &satPass:checkedSatPasses) {
+            std::vector<SatelliteForGUI::SatPass> checkedSatPasses = this->checkSatPass(pd,start_time,eph,station, *sun);
+            for(auto const &satPass:checkedSatPasses){
                 satellitePasses.push_back( satPass );
             }
         }
-        passList.push_back( satellitePasses );
+
+        if ( t >= tEnd ) {
+            visiblePrev = visible;
+            break;
+        }
+
+        /*
+         * largest step for which the satellite can not reach the next band boundary, therefore no pass (or gap)
+         * which reaches beyond the band and is longer than the minimum step can be skipped
+         */
+        double dt = time_step;
+        if ( visible && el > elHigh ) {
+            dt = ( el - elHigh ) / rateHigh;
+        } else if ( visible && el >= elLow ) {
+            dt = std::min( dt, ( el - elLow ) / rateHigh );
+        } else if ( !visible && el < elLow ) {
+            dt = ( elLow - el ) / rateLow;
+        } else if ( !visible && el <= elHigh ) {
+            dt = std::min( dt, ( elHigh - el ) / rateBand );
+        }
+
+        /*
+         * predict the crossing of the minimum elevation from elevation and its rate and stop just behind it,
+         * so that the root finder starts with a tight bracket
+         */
+        if ( t > 0 ) {
+            double rate = ( el - elPrev ) / ( t - tPrev );
+            double tCross = rate != 0 ? ( minElevation - el ) / rate : -1;
+            if ( tCross > 0 ) {
+                dt = std::min( dt, tCross + minimumSearchStep_ );
+            }
+        }
+        dt = std::max( dt, minimumSearchStep_ );
+
+        tPrev = t;
+        elPrev = el;
+        visiblePrev = visible;
+        t = std::min( t + dt, tEnd );
     }
-#ifdef VIESCHEDPP_LOG
-    BOOST_LOG_TRIVIAL( info ) << "finish generating passlists for stations sucessfully";
-#else
-    cout << "[info] finish generating passlists for stations sucessfully";
-#endif
-    return passList;
+
+    if ( visiblePrev ) {
+        /*
+         * satellite still above horizon at end of search period, so use end
+         * time as los
+         */
+        struct SatPass pd;
+        pd.start = aos_time;
+        pd.end = end_time;
+        pd.stationID = station.getId();
+        pd.satelliteID = this->getId();
+        std::vector<SatelliteForGUI::SatPass> checkedSatPasses = checkSatPass(pd,start_time,eph,station,*sun);
+
+        for(auto const &satPass:checkedSatPasses) {
+            satellitePasses.push_back( satPass );
+        }
+    }
+    return satellitePasses;
 }
 
-DateTime SatelliteForGUI::findCrossingPoint( const VieVS::Station& station, const SGP4& sgp4, const DateTime& initial_time1,
+DateTime SatelliteForGUI::findCrossingPoint( const VieVS::Station& station, const SatelliteEphemeris& eph, const DateTime& initial_time1,
                                        const DateTime& initial_time2, bool finding_aos ) const {
     CoordGeodetic user_geo( station.getPosition()->getLat(), station.getPosition()->getLon(),
                             station.getPosition()->getAltitude() / 1000, true );
     Observer obs( user_geo );
-    DateTime time1( initial_time1 );
-    DateTime time2( initial_time2 );
-    DateTime middle_time;
+    double minElevation = std::max( 0.0, station.getPARA().minElevation );
 
-    bool running = true;
-    while ( running ) {
-        middle_time = time1.AddSeconds( ( time2 - time1 ).TotalSeconds() / 2.0 );
-        /*
-         * calculate satellite position
-         */
-        Eci eci = sgp4.FindPosition( middle_time );
+    // visibility and elevation above minimum elevation at t seconds after initial_time1
+    auto evaluate = [&]( double t, double &f ) {
+        Eci eci = eph.FindPosition( initial_time1.AddSeconds( t ) );
         CoordTopocentric topo = obs.GetLookAngle( eci );
         VieVS::PointingVector pv = VieVS::PointingVector( 1, 0 );
         pv.setAz( topo.azimuth );
         pv.setEl( topo.elevation );
-        if ( station.isVisible( pv, 0 ) ) {
-            /*
-             * satellite above horizon
-             */
-            if ( finding_aos ) {
-                time2 = middle_time;
-            } else {
-                time1 = middle_time;
+        f = topo.elevation - minElevation;
+        return station.isVisible( pv, 0 );
+    };
+
+    /*
+     * Illinois (modified regula falsi) on the elevation, the bracket [a, b] is maintained with the visibility so that
+     * horizon mask steps can not break it. Bisection is used whenever the elevation does not change sign over the
+     * bracket (horizon mask) or the bracket did not halve within two iterations.
+     */
+    double a = 0;
+    double b = ( initial_time2 - initial_time1 ).TotalSeconds();
+    double fa;
+    double fb;
+    evaluate( a, fa );
+    evaluate( b, fb );
+    int side = 0;
+    int slow = 0;
+    double width = b - a;
+    while ( b - a > crossingTolerance_ ) {
+        double t = 0.5 * ( a + b );
+        if ( slow < 2 && fa * fb < 0 ) {
+            double secant = b - fb * ( b - a ) / ( fb - fa );
+            // stay a bit away from the bracket ends so that the bracket always shrinks
+            double guard = 0.25 * crossingTolerance_;
+            if ( secant > a + guard && secant < b - guard ) {
+                t = secant;
+            }
+        }
+
+        double ft;
+        if ( evaluate( t, ft ) == finding_aos ) {
+            b = t;
+            fb = ft;
+            if ( side == -1 ) {
+                fa *= 0.5;
             }
+            side = -1;
         } else {
-            if ( finding_aos ) {
-                time1 = middle_time;
-            } else {
-                time2 = middle_time;
+            a = t;
+            fa = ft;
+            if ( side == 1 ) {
+                fb *= 0.5;
             }
+            side = 1;
         }
-        if ( ( time2 - time1 ).TotalSeconds() < 0.0001 )  // if the timespan
-        {
-            /*
-             * two times are within a millisecond, stop
-             */
-            running = false;  // to quit the while loop
+
+        slow = b - a > 0.5 * width ? slow + 1 : 0;
+        if ( slow == 0 ) {
+            width = b - a;
         }
     }
-    return middle_time;
+    // return the visible end of the bracket
+    return initial_time1.AddSeconds( finding_aos ? b : a );
 }
 
 vector<SatelliteForGUI> SatelliteForGUI::readSatelliteFile( std::string filename ) {
-    vector<SatelliteForGUI> satellites;
-    try {
-        std::ifstream fid( filename );
-        std::string line;
-        std::string hdr;
-        std::string line1;
-        std::string line2;
-        if( fid.is_open() ) {
-            while ( getline( fid, line ) ) {
-                if ( isalpha( line[0] ) ) {
-                    hdr = boost::trim_copy(VieVS::util::simplify(line));
-                    continue;
-                }
-                else if ( line[0] == '1' ) {
-                    line1 = boost::trim_copy(line);
-                    continue;
-                }
-                else if ( line[0] == '2' ) {
-                    line2 = boost::trim_copy(line);
-                    if ( !hdr.empty() && !line1.empty() && !line2.empty() ) {
-                        SatelliteForGUI sat( hdr, line1, line2 );
-                        satellites.push_back( sat );
-                        hdr = "";
-                        line1 = "";
-                        line2 = "";
-                    }
-                    else {
-/*#ifdef VIESCHEDPP_LOG
-                        BOOST_LOG_TRIVIAL( error ) << "wrong file format for satellite input" << filename;
-#else
-                        cout << "[error] wrong file format for satellite input" << filename;
-#endif*/
-                        satellites.clear();
-                        throw "Wrong file format for satellite file! Please check the required format!";
-                    }
-                    continue;
-                }
-                else if(line.empty())
-                {
-                    if (!getline( fid, line ))
-                    {
-                        fid.close();
-                        break;
-                    }
-                    else
-                    {
-                        throw "Error reading the satellite file - there is an empty line in the file!";
-                    }
-                }
-                else {
-                    throw "Wrong file format for satellite file! Please check the required format!";
-                }
-            }
-            fid.close();
-        }
-        else {
-            throw "There was an error opening the file!";
-        }
-    } catch ( std::exception const& e ) {
-#ifdef VIESCHEDPP_LOG
-        BOOST_LOG_TRIVIAL( error ) << "unable to open " << filename;
-#else
-        cout << "[error] unable to open " << filename;
-#endif
-        throw -1;
-        //terminate();
-    }
-    return satellites;
+    return SatelliteCatalog( filename ).getSatellites();
 }
 
 CoordGeodetic SatelliteForGUI::getPosition(DateTime time)
 {
-    Eci eci(this->getSGP4Data()->FindPosition(time));
+    Eci eci(getEphemeris()->FindPosition(time));
     CoordGeodetic pos = eci.ToGeodetic();
     return pos;
 }
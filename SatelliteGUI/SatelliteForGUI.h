@@ -26,10 +26,14 @@
 
 #ifndef VIESCHEDPP_SATELLITEFORGUI_H
 #define VIESCHEDPP_SATELLITEFORGUI_H
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include "../VieSchedpp/SGP4/CoordTopocentric.h"
@@ -39,6 +43,7 @@
 #include "../VieSchedpp/Scan/PointingVector.h"
 #include "../VieSchedpp/Station/Network.h"
 #include "../VieSchedpp/Station/Station.h"
+#include "SatelliteEphemeris.h"
 
 
 class SatelliteForGUI : public VieVS::VieVS_NamedObject {
@@ -105,6 +110,16 @@ class SatelliteForGUI : public VieVS::VieVS_NamedObject {
      */
     Tle* getTleData() {return this->pTleData_; };
 
+    /**
+     * @brief ephemeris grid of this satellite for the current session
+     *
+     * The grid covers VieVS::TimeSystem::startTime until the session end and is computed once per satellite and
+     * session. It is shared read-only by all stations and threads.
+     *
+     * @return ECI ephemeris of this satellite
+     */
+    std::shared_ptr<const SatelliteEphemeris> getEphemeris() const;
+
     /**
      * @brief satellite pass for a station
      * @author Helene Wolf
@@ -116,6 +131,27 @@ class SatelliteForGUI : public VieVS::VieVS_NamedObject {
         unsigned long satelliteID;  ///< id of observed satellite
     };
 
+    /**
+     * @brief azimuth and elevation from a station to the sun on a fixed time grid
+     *
+     * Values are stored in contiguous arrays, node i belongs to i*step seconds after session start. Lookup is a
+     * direct index computation followed by a linear interpolation.
+     */
+    struct SunTable {
+        unsigned int step = 1800;  ///< grid step in seconds
+        std::vector<double> az;    ///< azimuth of sun at node i
+        std::vector<double> el;    ///< elevation of sun at node i
+
+        /**
+         * @brief interpolated azimuth and elevation of the sun
+         *
+         * @param seconds seconds since session start
+         * @param az interpolated azimuth
+         * @param el interpolated elevation
+         */
+        void azel( double seconds, double &az, double &el ) const;
+    };
+
     /**
      * @brief generates the list of satellite passes for one station
      * @author Helene Wolf
@@ -130,23 +166,51 @@ class SatelliteForGUI : public VieVS::VieVS_NamedObject {
     std::vector<std::vector<SatPass>> generatePassList( const VieVS::Network &network, const DateTime &start_time,
                                                         const DateTime &end_time, const int time_step ) const;
 
+    /**
+     * @brief generates the list of satellite passes for a single station
+     * @author Helene Wolf
+     *
+     * The step size adapts to the satellite geometry: from an upper bound of the angular rate of the line of sight the
+     * largest step is computed for which the satellite can not reach the elevation band of minimum elevation and
+     * horizon mask, close to the horizon the step ends just behind the crossing predicted from elevation and its
+     * rate. Passes and gaps which cross the band are found if they are longer than getMinimumSearchStep(), even if
+     * they are much shorter than time_step. Inside the band the visibility also depends on the horizon mask and the
+     * step is limited by time_step, so a pass or gap which starts and ends inside the band is only guaranteed to be
+     * found if it is longer than time_step. Horizon crossings are refined with findCrossingPoint().
+     *
+     * Thread safe: the function only reads the shared ephemeris and sun tables and uses its own observer, therefore
+     * (satellite, station) pairs can be computed in parallel.
+     *
+     * @param station station which is observing
+     * @param start_time start time of session
+     * @param end_time end time of session
+     * @param time_step maximum time step within the elevation band of minimum elevation and horizon mask
+     *
+     * @return list of satellite passes for this station
+     */
+    std::vector<SatPass> generatePassList( const VieVS::Station &station, const DateTime &start_time,
+                                           const DateTime &end_time, const int time_step ) const;
+
     /**
      * @brief find exact time when the satellite crosses the horizon of station
      * @author Helene Wolf
      *
+     * Safeguarded regula falsi (Illinois) on the elevation with bisection fallback, the visibility decides which end
+     * of the bracket is replaced. Iterates until the bracket is smaller than getCrossingTolerance().
+     *
      * @param station station for which the pass list is created
-     * @param sgp4 sgp4 data of satellite
+     * @param eph ephemeris of satellite
      * @param initial_time1 first time point of interval to find crossing point
      * @param initial_time2 second time point of interval to find crossing point
      * @param finding_aos boolean if signal is found
      *
-     * @return Date and time of the satellite crossing horizon
+     * @return first (aos) or last (los) visible time of the satellite crossing horizon
      */
-    DateTime findCrossingPoint( const VieVS::Station &station, const SGP4 &sgp4, const DateTime &initial_time1,
+    DateTime findCrossingPoint( const VieVS::Station &station, const SatelliteEphemeris &eph, const DateTime &initial_time1,
                                 const DateTime &initial_time2, bool finding_aos ) const;
 
     /**
-     * @brief reads the satellite file
+     * @brief reads the satellite file, see SatelliteCatalog
      * @author Helene Wolf
      *
      * @param filename_ name of file
@@ -169,29 +233,35 @@ class SatelliteForGUI : public VieVS::VieVS_NamedObject {
      * @brief checks the satellitePass concerning slew rates and sun distance
      * @author Helene Wolf
      *
+     * The axis rates of the mount (azimuth/elevation, hour angle/declination or X/Y) are computed analytically from
+     * the ephemeris velocity and compared with the antenna slew rates. Intervals with exceeded rates or a sun distance
+     * below 4 degrees are removed, their boundaries are refined by root finding to getCrossingTolerance(). Rate
+     * maxima between the samples are searched explicitly, so short violations close to the pole of the mount are
+     * found as well.
+     *
      * @param satPass satllite pass which will be checked
      * @param sessionStartTime time when the session is starting
-     * @param sgp4 satellite SGP4 data
+     * @param eph ephemeris of satellite
      * @param station for which this satellite pass is
-     * @param azelSun vector with azimuth and elevation to the sun in 30min intervals
+     * @param sun azimuth and elevation from this station to the sun
      *
      *
      * @return vector with satellite checked passes
      */
-    std::vector<SatelliteForGUI::SatPass> checkSatPass( struct SatPass satPass, DateTime sessionStartTime, SGP4 &sgp4, VieVS::Station station, std::vector<std::vector<double>> azelSun) const;
+    std::vector<SatelliteForGUI::SatPass> checkSatPass( struct SatPass satPass, DateTime sessionStartTime, const SatelliteEphemeris &eph, VieVS::Station station, const SunTable &sun) const;
 
     /**
      * @brief calculates the distance between satellite and sun
      * @author Helene Wolf
      *
-     * @param current_time time for which the distance whould be calculated
-     * @param station station for which the distance between sun and satellite is calculated
-     * @param azelSun vector with azimuth and elevation from this station to the sun in a 30min interval
-     * @param sessionStartTime time of session start
+     * @param seconds seconds since session start
+     * @param azSat azimuth of satellite seen from the station
+     * @param elSat elevation of satellite seen from the station
+     * @param sun azimuth and elevation from this station to the sun
      *
-     * @return distance between sun and satellite at current_time
+     * @return distance between sun and satellite
      */
-    double getSunDistance(DateTime current_time, VieVS::Station station, std::vector<std::vector<double>> azelSun, DateTime sessionStartTime) const;
+    static double getSunDistance( double seconds, double azSat, double elSat, const SunTable &sun );
 
     /**
      * @brief calculates the azimuth and elevation from a station to the sun for the whole session in 30min interval
@@ -201,17 +271,77 @@ class SatelliteForGUI : public VieVS::VieVS_NamedObject {
      * @param sessionStartTime time of session start
      * @param sessionEndTime time of session end
      *
+     * @param step grid step in seconds
+     *
      * @return azelSun vector with azimuth and elevation from this station to the sun in a 30min interval
      */
-    std::vector<std::vector<double>> static azelSun(VieVS::Station station, DateTime sessionStartTime, DateTime sessionEndTime );
+    std::vector<std::vector<double>> static azelSun(VieVS::Station station, DateTime sessionStartTime, DateTime sessionEndTime, unsigned int step = 1800 );
+
+    /**
+     * @brief cached azimuth and elevation from a station to the sun for the current session
+     *
+     * The table only depends on station and session, therefore it is computed once and shared read-only by all
+     * satellites and threads. The cache is dropped as soon as the session or the grid step changes.
+     *
+     * @param station station for which the table is needed
+     *
+     * @return azimuth and elevation of the sun in getSunGridStep() intervals
+     */
+    static std::shared_ptr<const SunTable> azelSunCached( const VieVS::Station &station );
+
+    /**
+     * @brief sets the grid step of the sun azimuth/elevation tables
+     *
+     * @param seconds grid step in seconds (default 1800)
+     */
+    static void setSunGridStep( unsigned int seconds );
+
+    /**
+     * @brief getter for grid step of the sun azimuth/elevation tables
+     *
+     * @return grid step in seconds
+     */
+    static unsigned int getSunGridStep() { return sunGridStep_; }
+
+    /**
+     * @brief sets the time tolerance of the horizon crossing search
+     *
+     * @param seconds tolerance in seconds (default 0.0001)
+     */
+    static void setCrossingTolerance( double seconds );
+
+    /**
+     * @brief getter for time tolerance of the horizon crossing search
+     *
+     * @return tolerance in seconds
+     */
+    static double getCrossingTolerance() { return crossingTolerance_; }
+
+    /**
+     * @brief sets the minimum step of the pass search
+     *
+     * Passes and gaps longer than this are guaranteed to be found.
+     *
+     * @param seconds minimum step in seconds (default 1)
+     */
+    static void setMinimumSearchStep( double seconds );
+
+    /**
+     * @brief getter for minimum step of the pass search
+     *
+     * @return minimum step in seconds
+     */
+    static double getMinimumSearchStep() { return minimumSearchStep_; }
 
     /**
      * @brief interpolates the ra and dec of sun over the whole session time in a 30 min interval
      * @author Helene Wolf
      *
+     * @param step grid step in seconds
+     *
      * @return tuple of vectors with time(seconds since session start), ra, dec of sun
      */
-    std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>> static interpolateRaDecSun();
+    std::tuple<std::vector<unsigned int>, std::vector<double>, std::vector<double>> static interpolateRaDecSun( unsigned int step = 1800 );
 
     /**
      * @brief calculation of right ascension, declination and local hour angle of satellite at specific time
@@ -235,6 +365,9 @@ class SatelliteForGUI : public VieVS::VieVS_NamedObject {
 
 private:
     static unsigned long nextId;  ///< next id for this object type
+    static unsigned int sunGridStep_;  ///< grid step of the sun azimuth/elevation tables in seconds
+    static double crossingTolerance_;  ///< time tolerance of horizon crossings in seconds
+    static double minimumSearchStep_;  ///< minimum step of the pass search in seconds
     std::string header_;           ///< header line of TLE Data
     std::string line1_;            ///< first line of TLE Data
     std::string line2_;            ///< second line of TLE Data
@@ -131,6 +131,7 @@ void SatelliteMain::initialize( const std::string &pathAntenna, const std::strin
     init.createStations( skdCatalogs, of );
 
     network_ = init.getNetwork();
+    clearPassCache();
 
     // set scan alignment anchor
     VieVS::ScanTimes::setAlignmentAnchor( VieVS::ScanTimes::AlignmentAnchor::individual );
@@ -142,24 +143,99 @@ vector<SatelliteForGUI> SatelliteMain::readSatelliteFile( const std::string &pat
     return  SatelliteForGUI::readSatelliteFile( pathToTLE );
 }
 
-vector<VieVS::Scan> SatelliteMain::generateScanList ( const vector<SatelliteForGUI> &satellites ) const{
+vector<VieVS::Scan> SatelliteMain::generateScanList ( const vector<SatelliteForGUI> &satellites,
+                                                      SatelliteProgress *progress ) const{
 
-    //[satellite][station][pass]
-    std::vector<std::vector<std::vector<SatelliteForGUI::SatPass>>> passLists;
-    for(const auto & thisSat : satellites){
-        passLists.push_back(thisSat.generatePassList(network_, startDate_, endDate_, 60));
+    // pass geometry does not depend on preob or field system time -> only compute passes of new satellites
+    if ( !computePasses( satellites, progress ) ) {
+        return {};
     }
 
-
     vector<VieVS::Scan> list;
-    for( size_t i=0; i< satellites.size(); ++i){
-        auto scanList = SatelliteObs::createScanList( passLists[i], network_, satellites[i], startDate_ );
+    for( const auto &sat : satellites ){
+        auto scanList = SatelliteObs::createScanList( getPasses( sat )->passList, network_, sat, startDate_ );
         list.insert(list.end(), scanList.begin(), scanList.end());
     }
 
     return list;
 }
 
+bool SatelliteMain::computePasses( const vector<SatelliteForGUI> &satellites, SatelliteProgress *progress ) const{
+    checkPassCacheSettings();
+    std::vector<int> missing;
+    for ( int i = 0; i < static_cast<int>( satellites.size() ); ++i ) {
+        if ( getPasses( satellites[i] ) == nullptr ) {
+            missing.push_back( i );
+        }
+    }
+
+    //[satellite][station][pass]
+    std::vector<std::vector<std::vector<SatelliteForGUI::SatPass>>> passLists(
+        missing.size(), std::vector<std::vector<SatelliteForGUI::SatPass>>( network_.getNSta() ) );
+
+    // every (satellite, station) pair is an independent task, results go to fixed slots -> deterministic merge
+    int nsta = static_cast<int>( network_.getNSta() );
+    int nTasks = static_cast<int>( missing.size() ) * nsta;
+    if ( progress != nullptr ) {
+        progress->done = 0;
+        progress->total = nTasks;
+    }
+
+    // ephemeris grids are shared by all stations, build them up front (each one is parallel over its nodes)
+    for ( int isat : missing ) {
+        satellites[isat].getEphemeris();
+    }
+
+    #pragma omp parallel for schedule(dynamic)
+    for ( int task = 0; task < nTasks; ++task ) {
+        if ( progress != nullptr && progress->canceled ) {
+            continue;
+        }
+        int isat = task / nsta;
+        int ista = task % nsta;
+        passLists[isat][ista] = satellites[missing[isat]].generatePassList( network_.getStation( ista ), startDate_, endDate_, 60 );
+        if ( progress != nullptr ) {
+            ++progress->done;
+        }
+    }
+    if ( progress != nullptr && progress->canceled ) {
+        return false;
+    }
+
+    double duration = ( endDate_ - startDate_ ).TotalSeconds();
+    for ( size_t i = 0; i < missing.size(); ++i ) {
+        const SatelliteForGUI &sat = satellites[missing[i]];
+        auto entry = std::make_shared<SatellitePasses>();
+        entry->line1 = sat.getLine1();
+        entry->line2 = sat.getLine2();
+        entry->passList = std::move( passLists[i] );
+        entry->coverage = SatelliteCoverageIndex( entry->passList, startDate_, duration );
+        passCache_[sat.getId()] = entry;
+    }
+    return true;
+}
+
+std::shared_ptr<const SatelliteMain::SatellitePasses> SatelliteMain::getPasses( const SatelliteForGUI &sat ) const {
+    auto it = passCache_.find( sat.getId() );
+    if ( it == passCache_.end() || it->second->line1 != sat.getLine1() || it->second->line2 != sat.getLine2() ) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void SatelliteMain::clearPassCache() const {
+    passCache_.clear();
+}
+
+void SatelliteMain::checkPassCacheSettings() const {
+    auto current = std::make_tuple( SatelliteForGUI::getSunGridStep(), SatelliteForGUI::getCrossingTolerance(),
+                                    SatelliteForGUI::getMinimumSearchStep() );
+    if ( current != passCacheSettings_ ) {
+        clearPassCache();
+        passCacheSettings_ = current;
+    }
+}
+
 VieVS::Scan SatelliteMain::createAdjustedScan(SatelliteForGUI sat,std::vector<unsigned long> selectedStationIds, std::vector<unsigned long> startTimes, std::vector<unsigned long> endTimes)
 {
     std::vector<VieVS::PointingVector> pointingVectorsStart;
@@ -27,13 +27,23 @@
 #define VIESCHEDPP_SATELLITEMAIN_H
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "../VieSchedpp/Scan/Scan.h"
 #include "../VieSchedpp/Station/Baseline.h"
 #include "../VieSchedpp/Station/Network.h"
 #include "../VieSchedpp/Initializer.h"
+#include "SatelliteCoverageIndex.h"
 #include "SatelliteForGUI.h"
 #include "SatelliteObs.h"
 #include "SatelliteOutput.h"
+#include "SatelliteProgress.h"
 #include "../VieSchedpp/SGP4/CoordGeodetic.h"
 #include "../VieSchedpp/SGP4/CoordTopocentric.h"
 #include "../VieSchedpp/SGP4/Eci.h"
@@ -59,16 +69,68 @@ class SatelliteMain {
 
     std::vector<SatelliteForGUI> readSatelliteFile( const std::string &pathToTLE ) const;
 
-    std::vector<VieVS::Scan> generateScanList( const std::vector<SatelliteForGUI> &satellites ) const;
+    /**
+     * @brief passes of one satellite, they only depend on the satellite, the network and the session
+     */
+    struct SatellitePasses {
+        std::string line1;                                                ///< TLE line 1 used for the passes
+        std::string line2;                                                ///< TLE line 2 used for the passes
+        std::vector<std::vector<SatelliteForGUI::SatPass>> passList;      ///< passes per station [station][pass]
+        SatelliteCoverageIndex coverage;                                  ///< visible stations over time
+    };
+
+    /**
+     * @brief computes the passes of all (satellite, station) pairs which are not cached yet in parallel
+     *
+     * @param satellites satellites
+     * @param progress optional progress (finished pairs, total pairs), polled by the caller, set canceled to cancel
+     * @return false if canceled
+     */
+    bool computePasses( const std::vector<SatelliteForGUI> &satellites, SatelliteProgress *progress = nullptr ) const;
+
+    /**
+     * @brief computes the passes of all (satellite, station) pairs in parallel and assembles the scans
+     *
+     * Passes and coverage are cached per satellite (see computePasses()). Preob and field system times only enter the scan assembly,
+     * therefore calling this function again after changing them only rebuilds the scans.
+     *
+     * @param satellites selected satellites
+     * @param progress optional progress (finished pairs, total pairs), polled by the caller, set canceled to cancel
+     * @return list of scans, empty if canceled
+     */
+    std::vector<VieVS::Scan> generateScanList( const std::vector<SatelliteForGUI> &satellites,
+                                               SatelliteProgress *progress = nullptr ) const;
 
     VieVS::Network &refNetwork() { return network_;    }
 
+    /**
+     * @brief cached passes of a satellite
+     *
+     * @param sat satellite
+     * @return passes or nullptr if they were not computed yet
+     */
+    std::shared_ptr<const SatellitePasses> getPasses( const SatelliteForGUI &sat ) const;
+
+    /**
+     * @brief drops all cached passes, has to be called if the station positions, masks or elevation cut-offs change
+     */
+    void clearPassCache() const;
+
     VieVS::Scan createAdjustedScan(SatelliteForGUI sat,std::vector<unsigned long> selectedStationIds, std::vector<unsigned long> startTimes, std::vector<unsigned long> endTimes);
 
    private:
     VieVS::Network network_;
     DateTime startDate_;
     DateTime endDate_;
+
+    /// settings the cached passes were computed with (sun grid step, crossing tolerance, minimum search step)
+    mutable std::tuple<unsigned int, double, double> passCacheSettings_{0, 0, 0};
+    mutable std::map<unsigned long, std::shared_ptr<const SatellitePasses>> passCache_;  ///< passes per satellite id
+
+    /**
+     * @brief drops the cache if the pass search settings changed since it was filled
+     */
+    void checkPassCacheSettings() const;
 };
 
 #endif  // VIESCHEDPP_SATELLITEMAIN_H
@@ -117,7 +117,13 @@ std::vector<SatelliteObs> SatelliteObs::passList2Overlap( std::vector<std::vecto
 }
 
 
-bool SatelliteObs::compareTimePoint( TimePoint i1, TimePoint i2 ) { return ( i1.time < i2.time ); }
+bool SatelliteObs::compareTimePoint( const TimePoint &i1, const TimePoint &i2 ) {
+    // at the same time windows which end are handled first, touching windows do not overlap
+    if ( i1.time == i2.time ) {
+        return i1.ts == VieVS::Timestamp::end && i2.ts == VieVS::Timestamp::start;
+    }
+    return ( i1.time < i2.time );
+}
 
 void SatelliteObs::removeStationID( std::vector<unsigned long> &stationIDs, unsigned long reStation ) {
     auto position = std::find( stationIDs.begin(), stationIDs.end(), reStation );
@@ -138,7 +144,7 @@ std::vector<std::vector<std::vector<VieVS::PointingVector>>> SatelliteObs::passL
     std::vector<std::vector<VieVS::PointingVector>> pvList;
     std::vector<std::vector<std::vector<VieVS::PointingVector>>> pvRes;
     std::vector<VieVS::Station> stations = network.getStations();
-    SGP4 *sgp4 = sat.getSGP4Data();
+    std::shared_ptr<const SatelliteEphemeris> eph = sat.getEphemeris();
     for ( unsigned long i = 0; i < passList.size(); i++ )  // i Station
     {
         pvList.clear();
@@ -157,7 +163,7 @@ std::vector<std::vector<std::vector<VieVS::PointingVector>>> SatelliteObs::passL
                 if ( current_time > end_time ) {
                     current_time = end_time;
                 }
-                Eci eci = sgp4->FindPosition( current_time );
+                Eci eci = eph->FindPosition( current_time );
                 CoordTopocentric topo = obs.GetLookAngle( eci );
                 pv.setAz( topo.azimuth );
                 pv.setEl( topo.elevation );
@@ -233,7 +239,8 @@ void SatelliteObs::createOutput( std::vector<std::vector<SatelliteForGUI::SatPas
     std::cout << std::endl;
 }
 
-void SatelliteObs::calcObservations( VieVS::Scan *scan, VieVS::Network &network, SatelliteForGUI sat, vector<VieVS::PointingVector> PV_start ) {
+void SatelliteObs::calcObservations( VieVS::Scan *scan, const VieVS::Network &network, const SatelliteForGUI &sat,
+                                     const vector<VieVS::PointingVector> &PV_start ) {
     vector<VieVS::Observation> obs = scan->getObservations();
     obs.clear();
     // bool valid = false;
@@ -260,8 +267,8 @@ void SatelliteObs::calcObservations( VieVS::Scan *scan, VieVS::Network &network,
     scan->setObservations( obs );
 }
 
-VieVS::PointingVector SatelliteObs::createPV( VieVS::Station station, SatelliteForGUI sat, DateTime sessionStartTime,
-                                              TimePoint timePoint ) {
+VieVS::PointingVector SatelliteObs::createPV( const VieVS::Station &station, const SatelliteForGUI &sat,
+                                              const DateTime &sessionStartTime, const TimePoint &timePoint ) {
     Observer obs( station.getPosition()->getLat() * 180 / pi, station.getPosition()->getLon() * 180 / pi,
                   station.getPosition()->getAltitude() / 1000 );
     VieVS::PointingVector pv( station.getId(), sat.getId() );
@@ -276,7 +283,7 @@ VieVS::PointingVector SatelliteObs::createPV( VieVS::Station station, SatelliteF
             break;
         }
     }
-    Eci eci = sat.getSGP4Data()->FindPosition( time );
+    Eci eci = sat.getEphemeris()->FindPosition( time );
     CoordTopocentric topo = obs.GetLookAngle( eci );
     pv.setAz( topo.azimuth );
     pv.setEl( topo.elevation );
@@ -314,11 +321,15 @@ void SatelliteObs::calcTopoRaDec(Eci obs, Eci sat)
 bool SatelliteObs::comparePV( VieVS::PointingVector pv1, VieVS::PointingVector pv2 ) { return ( pv1.getStaid() < pv2.getStaid() ); }
 
 std::vector<SatelliteObs::TimePoint> SatelliteObs::createSortedTimePoints(
-    std::vector<std::vector<SatelliteForGUI::SatPass>> &passList ) {
+    const std::vector<std::vector<SatelliteForGUI::SatPass>> &passList ) {
     std::vector<TimePoint> timePoints;
 
     for ( const auto &pass : passList ) {
         for ( const auto &any : pass ) {
+            // ends sort before starts at the same time, a window without duration would close before it opens
+            if ( any.end <= any.start ) {
+                continue;
+            }
             struct TimePoint tStart;
             tStart.time = any.start;
             tStart.ts = VieVS::Timestamp::start;
@@ -335,174 +346,99 @@ std::vector<SatelliteObs::TimePoint> SatelliteObs::createSortedTimePoints(
         }
     }
     // sort time points by time (start and end times)
-    std::sort( timePoints.begin(), timePoints.end(), compareTimePoint );
+    std::stable_sort( timePoints.begin(), timePoints.end(), compareTimePoint );
     return timePoints;
 }
 
 
-/*This function creates the List of possible scans. it converts the passlist array into an array of the type timepoint.
- * Then it is checked if the observation windows of  the stations are overlapping.
- * there is an vector ignoreNow which has a size of number of the stations and includes for each stations how many
- * observations windows should be ignored by running through the timepoints. if a station stops observing and would
- * start again during a scan, a 1 will be written in the vector ignoreNext, in the end (if ignoreNext isn't empty)
- * ignoreNext and ignoreNow will be added, so the number of observation windows to be ignored will increase.*/
+/*This function creates the List of possible scans. The pass list is converted into a sorted list of time points
+ * which is swept once. Stations with an open observation window are tracked in a bit set together with their count.
+ * A scan starts as soon as two stations observe simultaneously, later starting stations join it and a station whose
+ * window ends leaves it. The scan is emitted when less than two stations remain, the remaining station keeps its
+ * window open and can start the next scan together with other observing stations. A station which already left the
+ * current scan and opens a new window during this scan only becomes available again for the next scan.*/
 
-std::vector<VieVS::Scan> SatelliteObs::createScanList( std::vector<std::vector<SatelliteForGUI::SatPass>> passList, VieVS::Network network,
-                                                SatelliteForGUI sat, DateTime sessionStartTime ) {
+std::vector<VieVS::Scan> SatelliteObs::createScanList( const std::vector<std::vector<SatelliteForGUI::SatPass>> &passList,
+                                                       const VieVS::Network &network, const SatelliteForGUI &sat,
+                                                       const DateTime &sessionStartTime ) {
 #ifdef VIESCHEDPP_LOG
     BOOST_LOG_TRIVIAL( info ) << "start creating Scanlist";
 #else
     cout << "[info] start creating Scanlist";
 #endif
     std::vector<VieVS::Scan> scanList;
-    std::vector<TimePoint> timePoints;
     unsigned long nSta = network.getNSta();
-    std::vector<VieVS::Station> stations = network.getStations();
-    timePoints = createSortedTimePoints( passList );
-
-    std::vector<bool> isobs( nSta, false );
-    std::vector<int> ignoreNow( nSta, 0 );
-    std::vector<int> ignoreNext( nSta, 0 );
-
-    std::vector<int> isDone( nSta, 0 );
-    std::vector<int> ignoreNowCOPY( nSta, 0 );
+    const std::vector<VieVS::Station> &stations = network.getStations();
+    std::vector<TimePoint> timePoints = createSortedTimePoints( passList );
+
+    std::vector<char> active( nSta, false );  // station has an open observation window
+    std::vector<char> member( nSta, false );  // station observes in current scan
+    std::vector<char> done( nSta, false );    // station already left current scan
+    unsigned long nActive = 0;
+    unsigned long nMember = 0;
     vector<VieVS::PointingVector> pointingVectorsStart;
     vector<VieVS::PointingVector> pointingVectorsEnd;
-    bool isScan = false;
-
-    long i = 0;
-    while ( i < timePoints.size() ) {
-        if ( ignoreNow.at( timePoints.at( i ).stationID ) == 0 ) {
-            if ( isDone.at( timePoints.at( i ).stationID ) == 0 ) {
-                if ( !isScan ) {
-                    switch ( timePoints.at( i ).ts ) {
-                        case VieVS::Timestamp::start: {
-                            auto itr = std::find( isobs.begin(), isobs.end(), true );
-                            long idx = std::distance( isobs.begin(), itr );
-                            isobs[timePoints.at( i ).stationID] = true;
-                            if ( std::count( isobs.begin(), isobs.end(), true ) > 1 )  // start scan
-                            {
-                                VieVS::PointingVector pvStart( createPV( stations.at( timePoints.at( i ).stationID ), sat,
-                                                                  sessionStartTime, timePoints.at( i ) ) );
-                                VieVS::PointingVector pvStartPast(
-                                    createPV( stations.at( idx ), sat, sessionStartTime, timePoints.at( i ) ) );
-                                pointingVectorsStart.push_back( pvStart );
-                                pointingVectorsStart.push_back( pvStartPast );
-                                isScan = true;
-                                i++;
-                                continue;
-                            } else {
-                                i++;
-                                continue;
-                            }
-                        }
-                        case VieVS::Timestamp::end: {  // stations stops again to observe
-                            isobs[timePoints.at( i ).stationID] = false;
-                            ignoreNowCOPY[timePoints.at( i ).stationID] = ignoreNowCOPY[timePoints.at( i ).stationID]+1;
-                            i++;
-                            continue;
-                        }
-                    }
-                } else {
-                    switch ( timePoints.at( i ).ts ) {
-                        case VieVS::Timestamp::start: {
-                            isobs[timePoints.at( i ).stationID] = true;
-                            VieVS::PointingVector pvStart( createPV( stations.at( timePoints.at( i ).stationID ), sat,
-                                                              sessionStartTime, timePoints.at( i ) ) );
-                            pointingVectorsStart.push_back( pvStart );
-                            i++;
-                            continue;
-                        }
-                        case VieVS::Timestamp::end: {
-                            isobs[timePoints.at( i ).stationID] = false;
-                            isDone.at( timePoints.at( i ).stationID ) = 1;
-                            VieVS::PointingVector pvEnd( createPV( stations.at( timePoints.at( i ).stationID ), sat,
-                                                            sessionStartTime, timePoints.at( i ) ) );
-                            pointingVectorsEnd.push_back( pvEnd );
-                            if ( std::count( isobs.begin(), isobs.end(), true ) < 2 )  // finish this scan
-                            {
-                                auto itr = std::find( isobs.begin(), isobs.end(), true );
-                                long idx = std::distance( isobs.begin(), itr );
-                                VieVS::PointingVector pvEnd(
-                                    createPV( stations[idx], sat, sessionStartTime, timePoints.at( i ) ) );
-                                pointingVectorsEnd.push_back( pvEnd );
-                                std::sort( pointingVectorsStart.begin(), pointingVectorsStart.end(), comparePV );
-                                std::sort( pointingVectorsEnd.begin(), pointingVectorsEnd.end(), comparePV );
-                                unsigned long nsta = pointingVectorsStart.size();
-                                vector<unsigned int> endOfObservingTime( nsta, 0 );
-                                vector<unsigned int> endOfLastScans( nsta, 0 );
-                                vector<unsigned int> fieldSystemTimes( nsta, 0 );
-                                vector<unsigned int> slewTimes( nsta, 0 );
-                                vector<unsigned int> preobTimes( nsta, 0 );
-                                vector<unsigned int> pvStartTimes( nsta, 0 );
-                                vector<VieVS::PointingVector> pvstartcopy( pointingVectorsStart );
-
-                                for ( unsigned long k = 0; k < nsta; k++ ) {
-                                    endOfObservingTime.at( k ) = pointingVectorsEnd.at( k ).getTime();
-                                    pvStartTimes.at( k ) = pointingVectorsStart.at( k ).getTime();
-                                    fieldSystemTimes.at( k ) = network.getStation( k ).getPARA().systemDelay;
-                                    preobTimes.at( k ) = network.getStation( k ).getPARA().preob;
-                                    if ( pvStartTimes.at( k ) < ( fieldSystemTimes.at( k ) + preobTimes.at( k ) ) ) {
-                                        endOfLastScans.at( k ) = pvStartTimes.at( k );
-                                        fieldSystemTimes.at( k ) = 0;
-                                        preobTimes.at( k ) = 0;
-                                    } else {
-                                        endOfLastScans.at( k ) = pointingVectorsStart.at( k ).getTime() -
-                                                                 fieldSystemTimes.at( k ) - preobTimes.at( k );
-                                    }
-                                }
-                                VieVS::Scan scan( pointingVectorsStart, endOfLastScans, VieVS::Scan::ScanType::standard );
-                                scan.setScanTimes( endOfLastScans, fieldSystemTimes, slewTimes, preobTimes,
-                                                   pvStartTimes, endOfObservingTime);
-                                scan.setPointingVectorsEndtime( pointingVectorsEnd );
-                                calcObservations( &scan, network, sat, pvstartcopy );
-                                scanList.push_back( scan );
-                                isScan = false;
-                                std::vector<int> addThis;
-                                if ( std::count( ignoreNext.begin(), ignoreNext.end(), true ) == 0 ) {
-                                    if ( i == timePoints.size() - 2 ) {
-                                        break;
-                                    } else {
-                                        addThis = isDone;
-                                    }
-                                } else {
-                                    addThis = ignoreNext;
-                                }
-                                for ( unsigned long j = 0; j < ignoreNow.size(); j++ ) {
-                                    ignoreNow.at( j ) = ignoreNowCOPY.at( j ) + addThis.at( j );
-                                }
-                                i = -1;
-                                isobs.assign( nSta, false );
-                                isDone.assign( nSta, 0 );
-                                ignoreNext.assign( nSta, 0 );
-                                ignoreNowCOPY = ignoreNow;
-                                pointingVectorsStart.clear();
-                                pointingVectorsEnd.clear();
-                                i++;
-                                continue;
-                            } else {
-                                i++;
-                                continue;
-                            }
-                        }
+
+    // starts a scan with all stations with an open window
+    auto startScan = [&]( const TimePoint &timePoint ) {
+        for ( unsigned long k = 0; k < nSta; ++k ) {
+            if ( active[k] ) {
+                member[k] = true;
+                ++nMember;
+                pointingVectorsStart.push_back( createPV( stations[k], sat, sessionStartTime, timePoint ) );
+            }
+        }
+    };
+
+    for ( const TimePoint &timePoint : timePoints ) {
+        unsigned long staid = timePoint.stationID;
+        switch ( timePoint.ts ) {
+            case VieVS::Timestamp::start: {
+                active[staid] = true;
+                ++nActive;
+                if ( nMember == 0 ) {
+                    if ( nActive > 1 ) {
+                        startScan( timePoint );
                     }
+                } else if ( !done[staid] ) {
+                    member[staid] = true;
+                    ++nMember;
+                    pointingVectorsStart.push_back( createPV( stations[staid], sat, sessionStartTime, timePoint ) );
                 }
-            } else {
-                ignoreNext.at( timePoints.at( i ).stationID ) =
-                    1;  // one more observation window from this station will be ignored in the next run
-                i++;
+                break;
             }
-        } else {
-            switch ( timePoints.at( i ).ts ) {
-                case VieVS::Timestamp::start: {
-                    i++;
-                    continue;
+            case VieVS::Timestamp::end: {
+                active[staid] = false;
+                --nActive;
+                if ( !member[staid] ) {
+                    break;
                 }
-                case VieVS::Timestamp::end: {
-                    ignoreNow.at(
-                            timePoints.at( i ).stationID )--;  // one observation window was ignored, so reduce number by 1
-                    i++;
+                member[staid] = false;
+                done[staid] = true;
+                --nMember;
+                pointingVectorsEnd.push_back( createPV( stations[staid], sat, sessionStartTime, timePoint ) );
+                if ( nMember > 1 ) {
+                    break;
+                }
+
+                // finish this scan, the remaining station stops observing now
+                for ( unsigned long k = 0; k < nSta; ++k ) {
+                    if ( member[k] ) {
+                        pointingVectorsEnd.push_back( createPV( stations[k], sat, sessionStartTime, timePoint ) );
+                        member[k] = false;
+                    }
                 }
+                nMember = 0;
+                scanList.push_back( createScan( pointingVectorsStart, pointingVectorsEnd, network, sat ) );
+                pointingVectorsStart.clear();
+                pointingVectorsEnd.clear();
+                done.assign( nSta, false );
+
+                // stations which are still observing immediately form the next scan
+                if ( nActive > 1 ) {
+                    startScan( timePoint );
+                }
+                break;
             }
         }
     }
@@ -514,6 +450,41 @@ std::vector<VieVS::Scan> SatelliteObs::createScanList( std::vector<std::vector<S
     return scanList;
 }
 
+VieVS::Scan SatelliteObs::createScan( std::vector<VieVS::PointingVector> pointingVectorsStart,
+                                      std::vector<VieVS::PointingVector> pointingVectorsEnd,
+                                      const VieVS::Network &network, const SatelliteForGUI &sat ) {
+    std::sort( pointingVectorsStart.begin(), pointingVectorsStart.end(), comparePV );
+    std::sort( pointingVectorsEnd.begin(), pointingVectorsEnd.end(), comparePV );
+    unsigned long nsta = pointingVectorsStart.size();
+    vector<unsigned int> endOfObservingTime( nsta, 0 );
+    vector<unsigned int> endOfLastScans( nsta, 0 );
+    vector<unsigned int> fieldSystemTimes( nsta, 0 );
+    vector<unsigned int> slewTimes( nsta, 0 );
+    vector<unsigned int> preobTimes( nsta, 0 );
+    vector<unsigned int> pvStartTimes( nsta, 0 );
+    vector<VieVS::PointingVector> pvstartcopy( pointingVectorsStart );
+
+    for ( unsigned long k = 0; k < nsta; k++ ) {
+        const VieVS::Station &station = network.getStation( pointingVectorsStart.at( k ).getStaid() );
+        endOfObservingTime.at( k ) = pointingVectorsEnd.at( k ).getTime();
+        pvStartTimes.at( k ) = pointingVectorsStart.at( k ).getTime();
+        fieldSystemTimes.at( k ) = station.getPARA().systemDelay;
+        preobTimes.at( k ) = station.getPARA().preob;
+        if ( pvStartTimes.at( k ) < ( fieldSystemTimes.at( k ) + preobTimes.at( k ) ) ) {
+            endOfLastScans.at( k ) = pvStartTimes.at( k );
+            fieldSystemTimes.at( k ) = 0;
+            preobTimes.at( k ) = 0;
+        } else {
+            endOfLastScans.at( k ) = pointingVectorsStart.at( k ).getTime() - fieldSystemTimes.at( k ) - preobTimes.at( k );
+        }
+    }
+    VieVS::Scan scan( pointingVectorsStart, endOfLastScans, VieVS::Scan::ScanType::standard );
+    scan.setScanTimes( endOfLastScans, fieldSystemTimes, slewTimes, preobTimes, pvStartTimes, endOfObservingTime );
+    scan.setPointingVectorsEndtime( pointingVectorsEnd );
+    calcObservations( &scan, network, sat, pvstartcopy );
+    return scan;
+}
+
 
 void SatelliteObs::totextfile( std::vector<std::vector<std::vector<VieVS::PointingVector>>> pvRes)
 {
@@ -125,7 +125,7 @@ class SatelliteObs : public VieVS::VieVS_NamedObject {
      * @param i2 time of TimePoint1
      * @return boolean i1 < i2
      */
-    static bool compareTimePoint( TimePoint i1, TimePoint i2 );
+    static bool compareTimePoint( const TimePoint &i1, const TimePoint &i2 );
 
     /**
      * @brief removes Station ID
@@ -146,7 +146,8 @@ class SatelliteObs : public VieVS::VieVS_NamedObject {
      * @param sat satellite
      * @param PV_start vector of pointing vectors for each observing station at start time
      */
-    static void calcObservations( VieVS::Scan *scan, VieVS::Network &network, SatelliteForGUI sat, std::vector<VieVS::PointingVector> PV_start );
+    static void calcObservations( VieVS::Scan *scan, const VieVS::Network &network, const SatelliteForGUI &sat,
+                                  const std::vector<VieVS::PointingVector> &PV_start );
 
     /**
      * @brief create Pointing Vectors
@@ -166,6 +167,9 @@ class SatelliteObs : public VieVS::VieVS_NamedObject {
      * @brief create scan list, convert PassList to scans
      * @author Helene Wolf
      *
+     * Single sweep over the sorted start and end time points, linear in the number of passes (plus one pass over the
+     * stations for every emitted scan).
+     *
      * @param PassList list of satellite passes
      * @param network station network
      * @param sat satellite
@@ -173,8 +177,23 @@ class SatelliteObs : public VieVS::VieVS_NamedObject {
      *
      * @return List of scans ->  [Scan]
      */
-    std::vector<VieVS::Scan> static createScanList( std::vector<std::vector<SatelliteForGUI::SatPass>> passList, VieVS::Network network,
-                                             SatelliteForGUI sat, DateTime sessionStartTime );
+    std::vector<VieVS::Scan> static createScanList( const std::vector<std::vector<SatelliteForGUI::SatPass>> &passList,
+                                                    const VieVS::Network &network, const SatelliteForGUI &sat,
+                                                    const DateTime &sessionStartTime );
+
+    /**
+     * @brief create scan from start and end pointing vectors of the observing stations
+     *
+     * @param pointingVectorsStart pointing vectors at observation start
+     * @param pointingVectorsEnd pointing vectors at observation end
+     * @param network station network
+     * @param sat satellite
+     *
+     * @return scan including observations
+     */
+    VieVS::Scan static createScan( std::vector<VieVS::PointingVector> pointingVectorsStart,
+                                   std::vector<VieVS::PointingVector> pointingVectorsEnd, const VieVS::Network &network,
+                                   const SatelliteForGUI &sat );
 
     /**
      * @brief create pointing vector
@@ -187,19 +206,21 @@ class SatelliteObs : public VieVS::VieVS_NamedObject {
      *
      * @return pointing Vector
      */
-    VieVS::PointingVector static createPV( VieVS::Station station, SatelliteForGUI sat, DateTime sessionStartTime,
-                                           TimePoint timePoint );
+    VieVS::PointingVector static createPV( const VieVS::Station &station, const SatelliteForGUI &sat,
+                                           const DateTime &sessionStartTime, const TimePoint &timePoint );
 
     /**
      * @brief converts the PassList to a sorted list of Timepoints
      * @author Helene Wolf
      *
+     * Passes without duration are skipped, they can not overlap any other pass.
+     *
      * @param PassList list of stallite observations
      *
      * @return vector of sorted timepoints ->  [TimePoint]
      */
     static std::vector<SatelliteObs::TimePoint> createSortedTimePoints(
-        std::vector<std::vector<SatelliteForGUI::SatPass>> &passList );
+        const std::vector<std::vector<SatelliteForGUI::SatPass>> &passList );
 
 
     /**
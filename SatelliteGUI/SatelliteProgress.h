@@ -0,0 +1,38 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef VIESCHEDPP_SATELLITEPROGRESS_H
+#define VIESCHEDPP_SATELLITEPROGRESS_H
+
+#include <atomic>
+
+/**
+ * @brief progress of a parallel computation
+ *
+ * The worker threads only increment done and check canceled, the GUI thread polls done and sets canceled. No GUI
+ * function is called from inside the parallel region (see qtUtil::runWithProgress()).
+ */
+struct SatelliteProgress {
+    std::atomic<int> done{0};           ///< finished tasks
+    std::atomic<int> total{0};          ///< number of tasks, set when the computation starts
+    std::atomic<bool> canceled{false};  ///< set to cancel the computation
+};
+
+#endif  // VIESCHEDPP_SATELLITEPROGRESS_H
@@ -0,0 +1,127 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "SatelliteScanAssembler.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+SatelliteScanAssembler::SatelliteScanAssembler( const VieVS::Network &network ) : network_( network ) {}
+
+double SatelliteScanAssembler::weight( const VieVS::Scan &scan, double priority ) {
+    const VieVS::ScanTimes &times = scan.getTimes();
+    double duration = 0;
+    for ( unsigned long i = 0; i < scan.getNSta(); ++i ) {
+        duration += times.getObservingTime( i, VieVS::Timestamp::end ) -
+                    static_cast<double>( times.getObservingTime( i, VieVS::Timestamp::start ) );
+    }
+    // mean observing duration x number of baselines
+    double nSta = static_cast<double>( scan.getNSta() );
+    return nSta == 0 ? 0 : priority * duration * ( nSta - 1 ) / 2;
+}
+
+std::vector<int> SatelliteScanAssembler::assemble( const std::vector<VieVS::Scan> &candidates,
+                                                   const std::vector<double> &priorities,
+                                                   const std::vector<VieVS::Scan> &fixed ) {
+    bookings_.clear();
+    for ( const auto &scan : fixed ) {
+        book( scan );
+    }
+
+    int n = static_cast<int>( candidates.size() );
+    std::vector<double> weights( n );
+    for ( int i = 0; i < n; ++i ) {
+        weights[i] = weight( candidates[i], priorities.empty() ? 1.0 : priorities[i] );
+    }
+
+    // heaviest scan first, earlier scan first for equal weights so that the result does not depend on the input order
+    std::vector<int> order( n );
+    std::iota( order.begin(), order.end(), 0 );
+    std::sort( order.begin(), order.end(), [&]( int a, int b ) {
+        if ( weights[a] != weights[b] ) {
+            return weights[a] > weights[b];
+        }
+        unsigned int sa = candidates[a].getTimes().getScanTime( VieVS::Timestamp::start );
+        unsigned int sb = candidates[b].getTimes().getScanTime( VieVS::Timestamp::start );
+        return sa != sb ? sa < sb : a < b;
+    } );
+
+    std::vector<int> selected;
+    for ( int i : order ) {
+        if ( weights[i] > 0 && fits( candidates[i] ) ) {
+            book( candidates[i] );
+            selected.push_back( i );
+        }
+    }
+
+    std::sort( selected.begin(), selected.end(), [&]( int a, int b ) {
+        return candidates[a].getTimes().getScanTime( VieVS::Timestamp::start ) <
+               candidates[b].getTimes().getScanTime( VieVS::Timestamp::start );
+    } );
+    return selected;
+}
+
+bool SatelliteScanAssembler::fits( const VieVS::Scan &scan ) const {
+    const VieVS::ScanTimes &times = scan.getTimes();
+    for ( unsigned long i = 0; i < scan.getNSta(); ++i ) {
+        const VieVS::PointingVector &pvStart = scan.getPointingVector( i, VieVS::Timestamp::start );
+        const VieVS::PointingVector &pvEnd = scan.getPointingVector( i, VieVS::Timestamp::end );
+        unsigned long staid = pvStart.getStaid();
+        auto it = bookings_.find( staid );
+        if ( it == bookings_.end() ) {
+            continue;
+        }
+        const std::map<unsigned int, Booking> &booked = it->second;
+        unsigned int start = times.getObservingTime( i, VieVS::Timestamp::start );
+        unsigned int end = times.getObservingTime( i, VieVS::Timestamp::end );
+
+        // bookings of a station do not overlap, only the direct neighbors can conflict
+        auto next = booked.lower_bound( start );
+        if ( next != booked.end() && next->first < end + requiredGap( staid, pvEnd, next->second.pvStart ) ) {
+            return false;
+        }
+        if ( next != booked.begin() ) {
+            auto prev = std::prev( next );
+            if ( start < prev->second.end + requiredGap( staid, prev->second.pvEnd, pvStart ) ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void SatelliteScanAssembler::book( const VieVS::Scan &scan ) {
+    const VieVS::ScanTimes &times = scan.getTimes();
+    for ( unsigned long i = 0; i < scan.getNSta(); ++i ) {
+        const VieVS::PointingVector &pvStart = scan.getPointingVector( i, VieVS::Timestamp::start );
+        Booking booking{times.getObservingTime( i, VieVS::Timestamp::end ), pvStart,
+                        scan.getPointingVector( i, VieVS::Timestamp::end )};
+        bookings_[pvStart.getStaid()].emplace( times.getObservingTime( i, VieVS::Timestamp::start ), booking );
+    }
+}
+
+unsigned int SatelliteScanAssembler::requiredGap( unsigned long staid, const VieVS::PointingVector &from,
+                                                  const VieVS::PointingVector &to ) const {
+    const VieVS::Station &station = network_.getStation( staid );
+    VieVS::PointingVector target( to );
+    station.getCableWrap().calcUnwrappedAz( from, target );
+    unsigned int slew = station.getAntenna().slewTime( from, target );
+    return station.getPARA().systemDelay + slew + station.getPARA().preob;
+}
@@ -0,0 +1,91 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef VIESCHEDPP_SATELLITESCANASSEMBLER_H
+#define VIESCHEDPP_SATELLITESCANASSEMBLER_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include "../VieSchedpp/Scan/PointingVector.h"
+#include "../VieSchedpp/Scan/Scan.h"
+#include "../VieSchedpp/Station/Network.h"
+
+/**
+ * @brief assembles a conflict free schedule from the candidate scans of all satellites
+ *
+ * Two scans conflict if they share a station and the station can not finish the first scan, run its field system
+ * and preob time and slew to the second scan in between. Candidates are accepted in order of decreasing weight
+ * (priority x observing duration x number of baselines) if they do not conflict with an already accepted scan.
+ *
+ * The accepted observing intervals of every station are kept in an ordered map, a conflict can only occur with the
+ * neighbors of a new interval, therefore each check costs O(log n) per station and the whole assembly
+ * O(n log n) per station.
+ */
+class SatelliteScanAssembler {
+   public:
+    /**
+     * @brief constructor
+     *
+     * @param network observing network (field system time, preob time, antenna and cable wrap per station)
+     */
+    explicit SatelliteScanAssembler( const VieVS::Network &network );
+
+    /**
+     * @brief selects a conflict free subset of candidate scans
+     *
+     * @param candidates candidate scans of all satellites
+     * @param priorities priority of each candidate (same size as candidates, empty means priority 1 for all)
+     * @param fixed scans which are already scheduled, they are always kept
+     * @return indices of selected candidates sorted by scan start
+     */
+    std::vector<int> assemble( const std::vector<VieVS::Scan> &candidates, const std::vector<double> &priorities,
+                               const std::vector<VieVS::Scan> &fixed = {} );
+
+    /**
+     * @brief weight of a scan
+     *
+     * @param scan scan
+     * @param priority priority of scan
+     * @return priority x observing duration [s] x number of baselines
+     */
+    static double weight( const VieVS::Scan &scan, double priority );
+
+   private:
+    /**
+     * @brief observing interval of one station in an accepted scan
+     */
+    struct Booking {
+        unsigned int end;                  ///< end of observation [s]
+        VieVS::PointingVector pvStart;     ///< pointing at start of observation
+        VieVS::PointingVector pvEnd;       ///< pointing at end of observation
+    };
+
+    const VieVS::Network &network_;                                        ///< observing network
+    std::unordered_map<unsigned long, std::map<unsigned int, Booking>> bookings_;  ///< bookings per station id
+
+    bool fits( const VieVS::Scan &scan ) const;
+
+    void book( const VieVS::Scan &scan );
+
+    unsigned int requiredGap( unsigned long staid, const VieVS::PointingVector &from,
+                              const VieVS::PointingVector &to ) const;
+};
+
+#endif  // VIESCHEDPP_SATELLITESCANASSEMBLER_H
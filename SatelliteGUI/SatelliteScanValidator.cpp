@@ -0,0 +1,131 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "SatelliteScanValidator.h"
+
+#include <algorithm>
+
+namespace {
+    bool compareStart( const SatelliteScanValidator::Interval &a, const SatelliteScanValidator::Interval &b ) {
+        return a.start < b.start;
+    }
+}  // namespace
+
+void SatelliteScanValidator::reset( std::size_t nRows ) {
+    rows_.assign( nRows, Row() );
+    nActive_ = 0;
+    coverage_.clear();
+    passWindows_.clear();
+    scheduled_.clear();
+}
+
+void SatelliteScanValidator::setPassWindows( unsigned long staid, std::vector<Interval> windows ) {
+    std::sort( windows.begin(), windows.end(), compareStart );
+    passWindows_[staid] = std::move( windows );
+}
+
+void SatelliteScanValidator::setScheduled( unsigned long staid, std::vector<Interval> scans ) {
+    std::sort( scans.begin(), scans.end(), compareStart );
+    scheduled_[staid] = std::move( scans );
+}
+
+void SatelliteScanValidator::setRow( std::size_t row, unsigned long staid, long start, long end, bool active ) {
+    Row &r = rows_[row];
+    if ( r.active ) {
+        addCoverage( r.start, -1 );
+        addCoverage( r.end, 1 );
+        --nActive_;
+    }
+
+    r.staid = staid;
+    r.start = start;
+    r.end = end;
+    r.active = active && start < end;
+    r.flags = 0;
+    if ( r.active ) {
+        addCoverage( r.start, 1 );
+        addCoverage( r.end, -1 );
+        ++nActive_;
+        r.flags = evaluate( r );
+    }
+}
+
+void SatelliteScanValidator::addCoverage( long time, int delta ) {
+    auto it = coverage_.emplace( time, 0 ).first;
+    it->second += delta;
+    if ( it->second == 0 ) {
+        coverage_.erase( it );
+    }
+}
+
+unsigned char SatelliteScanValidator::evaluate( const Row &row ) const {
+    unsigned char flags = 0;
+
+    // last window which starts before the row has to contain it, skipped if no pass windows are known
+    bool inside = passWindows_.empty();
+    auto pw = passWindows_.find( row.staid );
+    if ( pw != passWindows_.end() ) {
+        const std::vector<Interval> &windows = pw->second;
+        auto it = std::upper_bound( windows.begin(), windows.end(), Interval{row.start, row.start}, compareStart );
+        inside = it != windows.begin() && std::prev( it )->end >= row.end;
+    }
+    if ( !inside ) {
+        flags |= outsidePass;
+    }
+
+    // scheduled intervals of one station do not overlap, so they are also sorted by end, touching intervals do not
+    // overlap (half open)
+    auto sc = scheduled_.find( row.staid );
+    if ( sc != scheduled_.end() ) {
+        const std::vector<Interval> &scans = sc->second;
+        auto it = std::lower_bound( scans.begin(), scans.end(), row.start,
+                                    []( const Interval &a, long t ) { return a.end <= t; } );
+        if ( it != scans.end() && it->start < row.end ) {
+            flags |= overlapsScheduled;
+        }
+    }
+    return flags;
+}
+
+std::vector<SatelliteScanValidator::Interval> SatelliteScanValidator::getUncoveredIntervals() const {
+    std::vector<Interval> uncovered;
+    int n = 0;
+    for ( auto it = coverage_.begin(); it != coverage_.end(); ++it ) {
+        n += it->second;
+        auto next = std::next( it );
+        if ( next == coverage_.end() ) {
+            break;
+        }
+        if ( n < 2 ) {
+            if ( !uncovered.empty() && uncovered.back().end == it->first ) {
+                uncovered.back().end = next->first;
+            } else {
+                uncovered.push_back( Interval{it->first, next->first} );
+            }
+        }
+    }
+    return uncovered;
+}
+
+bool SatelliteScanValidator::isValid() const {
+    if ( nActive_ < 2 || !getUncoveredIntervals().empty() ) {
+        return false;
+    }
+    return std::none_of( rows_.begin(), rows_.end(), []( const Row &r ) { return r.flags != 0; } );
+}
@@ -0,0 +1,145 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef VIESCHEDPP_SATELLITESCANVALIDATOR_H
+#define VIESCHEDPP_SATELLITESCANVALIDATOR_H
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+/**
+ * @brief incremental validation of a manually adjusted satellite scan
+ *
+ * Every row is the observing interval of one station. The number of observing stations over time is kept as a map of
+ * coverage changes, therefore editing one row only removes and inserts its two boundaries. Rows are also checked
+ * against the cached pass windows of their station and against the scans which are already scheduled.
+ *
+ * All times are seconds since session start, intervals are half open [start, end).
+ */
+class SatelliteScanValidator {
+   public:
+    /**
+     * @brief time interval
+     */
+    struct Interval {
+        long start;  ///< start time [s]
+        long end;    ///< end time [s]
+    };
+
+    /**
+     * @brief problems of one row
+     */
+    enum RowFlag : unsigned char {
+        outsidePass = 1,        ///< satellite is not visible from the station during the whole interval
+        overlapsScheduled = 2,  ///< station observes another scheduled scan during the interval
+    };
+
+    /**
+     * @brief removes all rows, pass windows and scheduled scans
+     *
+     * @param nRows number of rows
+     */
+    void reset( std::size_t nRows );
+
+    /**
+     * @brief sets the pass windows of a station
+     *
+     * If no pass windows are set for any station the pass check is skipped, stations without pass windows are
+     * never visible otherwise.
+     *
+     * @param staid station id
+     * @param windows pass windows
+     */
+    void setPassWindows( unsigned long staid, std::vector<Interval> windows );
+
+    /**
+     * @brief sets the observing intervals of a station in the scheduled scans
+     *
+     * @param staid station id
+     * @param scans observing intervals, they do not overlap each other
+     */
+    void setScheduled( unsigned long staid, std::vector<Interval> scans );
+
+    /**
+     * @brief updates one row
+     *
+     * rows which are not active or have an empty interval do not take part in the scan
+     *
+     * @param row row index
+     * @param staid station id
+     * @param start start time [s]
+     * @param end end time [s]
+     * @param active true if the station is selected
+     */
+    void setRow( std::size_t row, unsigned long staid, long start, long end, bool active );
+
+    /**
+     * @brief combination of RowFlag of a row
+     *
+     * @param row row index
+     * @return flags, 0 if the row is fine or not active
+     */
+    unsigned char getRowFlags( std::size_t row ) const { return rows_[row].flags; }
+
+    /**
+     * @brief number of rows which take part in the scan
+     *
+     * @return number of active rows
+     */
+    std::size_t numberOfActiveRows() const noexcept { return nActive_; }
+
+    /**
+     * @brief intervals between the first start and the last end in which less than two stations observe
+     *
+     * @return intervals in which a station observes alone or nobody observes
+     */
+    std::vector<Interval> getUncoveredIntervals() const;
+
+    /**
+     * @brief checks if the rows form a valid scan
+     *
+     * @return true if at least two stations observe all the time and no row has a flag
+     */
+    bool isValid() const;
+
+   private:
+    /**
+     * @brief one station of the scan
+     */
+    struct Row {
+        unsigned long staid = 0;  ///< station id
+        long start = 0;           ///< start time [s]
+        long end = 0;             ///< end time [s]
+        bool active = false;      ///< true if the row takes part in the scan
+        unsigned char flags = 0;  ///< combination of RowFlag
+    };
+
+    std::vector<Row> rows_;                                       ///< rows of the scan
+    std::size_t nActive_ = 0;                                     ///< number of active rows
+    std::map<long, int> coverage_;                                ///< change of observing stations per time
+    std::map<unsigned long, std::vector<Interval>> passWindows_;  ///< pass windows per station, sorted
+    std::map<unsigned long, std::vector<Interval>> scheduled_;    ///< scheduled intervals per station, sorted
+
+    void addCoverage( long time, int delta );
+
+    unsigned char evaluate( const Row &row ) const;
+};
+
+#endif  // VIESCHEDPP_SATELLITESCANVALIDATOR_H
@@ -1,11 +1,14 @@
 #include "satellitescheduling.h"
 #include "ui_satellitescheduling.h"
+#include <cmath>
 #include <limits>
 #include <tuple>
+#include <QSet>
+#include <QtConcurrent/QtConcurrent>
 
 SatelliteScheduling::SatelliteScheduling(const QString &pathAntenna, const QString &pathEquip,
                                          const QString &pathPosition, const QString &pathMask,
-                                         const QString &pathSat,
+                                         std::shared_ptr<const SatelliteCatalog> catalog,
                                          QStandardItemModel *selectedSatelliteModel,
                                          QStandardItemModel *allSatelliteModel,
                                          QStandardItemModel *allSatellitePlusGroupModel,
@@ -19,22 +22,18 @@ SatelliteScheduling::SatelliteScheduling(const QString &pathAntenna, const QStri
     allSatelliteModel{allSatelliteModel},
     selectedSatelliteModel{selectedSatelliteModel},
     allSatellitePlusGroupModel{allSatellitePlusGroupModel},  
-    groupSat{groupSat}
+    groupSat{groupSat},
+    catalog_{catalog}
 {
     ui->setupUi(this);
     settings_ = settings;
-    try {
-        satellites = satelliteScheduler.readSatelliteFile(pathSat.toStdString());
-    }
-    catch(const char* msg)
-    {
-        QMessageBox::warning(this,"Error loading satellites!",msg);
-        return;
-    }
-    if(satellites.empty()){
+    trackWatcher_ = new QFutureWatcher<GroundTracks>(this);
+    connect(trackWatcher_, SIGNAL(finished()), this, SLOT(groundTracksFinished()));
+    if(!catalog_ || catalog_->size() == 0){
         QMessageBox::warning(this,"No satellites found!","There was no satellite information provided within the selected file!");
         return;
     }
+    satellites = catalog_->getSatellites();
     ui->stackedWidget->setCurrentIndex(0);
     ui->dateTimeEdit_sessionStart->setDateTime(startTime);
     ui->dateTimeEdit_sessionEnd->setDateTime(endTime);
@@ -102,6 +101,7 @@ SatelliteScheduling::SatelliteScheduling(const QString &pathAntenna, const QStri
     selectedStations->setName("selectedStations");
 
     worldChart->addSeries(selectedStations);
+    stationHoverIndex = new SeriesPointIndex(this);
 
     connect(selectedStations,SIGNAL(hovered(QPointF,bool)),this,SLOT(worldmap_hovered(QPointF,bool)));
 
@@ -128,20 +128,27 @@ SatelliteScheduling::SatelliteScheduling(const QString &pathAntenna, const QStri
 
 SatelliteScheduling::~SatelliteScheduling()
 {
+    computation_.waitForFinished();
     delete ui;
 }
 
+void SatelliteScheduling::closeEvent(QCloseEvent *event)
+{
+    // the running computation references this window
+    if(computation_.isRunning()){
+        event->ignore();
+        return;
+    }
+    QMainWindow::closeEvent(event);
+}
+
 boost::property_tree::ptree SatelliteScheduling::toPropertyTree()
 {
     boost::property_tree::ptree tree;
     for(const auto &scan : scheduledScans){
-        unsigned long srcid = scan.getSourceId();
-        unsigned long idx = 0;
-        for (idx=0; idx < satellites.size(); ++idx ) {
-            if(satellites[idx].getId() == srcid)
-            {
-                break;
-            }
+        int idx = catalog_->findId(scan.getSourceId());
+        if(idx == -1){
+            continue;
         }
         std::string sourceName = satellites[idx].getName();
         boost::property_tree::ptree scan_tree = scan.toPropertyTree(satelliteScheduler.refNetwork(), sourceName);
@@ -174,11 +181,10 @@ void SatelliteScheduling::on_treeView_available_clicked(const QModelIndex &index
     QString name = proxy->index(row,0).data().toString();
 
     QDateTime satEpoch;
-    for(SatelliteForGUI &sat : satellites){
-        if(name == QString::fromStdString(sat.getName())) {
-            DateTime ti = sat.getTleData()->Epoch();
-            satEpoch = QDateTime(QDate(ti.Year(),ti.Month(),ti.Day()), QTime(ti.Hour(),ti.Minute(),ti.Second()));
-        }
+    int idx = catalog_->findName(name.toStdString());
+    if(idx != -1) {
+        DateTime ti = satellites[idx].getTleData()->Epoch();
+        satEpoch = QDateTime(QDate(ti.Year(),ti.Month(),ti.Day()), QTime(ti.Hour(),ti.Minute(),ti.Second()));
     }
 
     if( selectedSatelliteModel->findItems(name,Qt::MatchExactly).isEmpty()){
@@ -220,15 +226,7 @@ void SatelliteScheduling::on_treeView_selected_clicked(const QModelIndex &index)
 {
     int row = index.row();
     QString Satname = QString::fromStdString(selectedSatelliteModel->item(row)->text().toStdString());
-    auto series = worldmap->chart()->series();
-    for(int i=0; i<series.count();++i)
-    {
-        QString name = series.at(i)->name();
-        name.remove(0, 3);
-        if(Satname == name) {
-           worldmap->chart()->removeSeries(series.at(i));
-        }
-    }
+    removeGroundTrack(Satname);
     selectedSatelliteModel->removeRow(row);
 }
 
@@ -243,52 +241,9 @@ void SatelliteScheduling::on_dateTimeEdit_showTime_dateTimeChanged(const QDateTi
 void SatelliteScheduling::on_horizontalSlider_adjustTime_valueChanged(int value)
 {
     auto start = ui->dateTimeEdit_sessionStart->dateTime();
-    DateTime t = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
     start = start.addSecs(value);
     ui->dateTimeEdit_showTime->setDateTime(start);
-    int scanDur = sessionStart_.secsTo(ui->dateTimeEdit_showTime->dateTime());
-
-    QScatterSeries *satelliteMarker = new QScatterSeries(worldmap->chart());
-    QImage img(":/icons/icons/satellite.png");
-    satelliteMarker->setBrush(QBrush(img));
-    satelliteMarker->setMarkerShape(QScatterSeries::MarkerShapeRectangle);
-    satelliteMarker->setMarkerSize(40);
-    satelliteMarker->setPen(QColor(Qt::transparent));
-
-    if(ui->checkBox_showTracks->isChecked())
-    {
-        auto series = worldmap->chart()->series();
-        for(int i=0; i<series.count();++i)
-        {
-            QString name = series.at(i)->name();        
-            QString leftSide = name.left(3);
-            if((leftSide == "mrk"))
-            {
-               QScatterSeries *satelliteMarker = new QScatterSeries(worldmap->chart());
-               satelliteMarker->clear();
-               QImage img(":/icons/icons/satellite.png");
-               satelliteMarker->setBrush(QBrush(img));
-               satelliteMarker->setMarkerShape(QScatterSeries::MarkerShapeRectangle);
-               satelliteMarker->setMarkerSize(40);
-               satelliteMarker->setPen(QColor(Qt::transparent));
-               worldmap->chart()->addSeries(satelliteMarker);
-               satelliteMarker->attachAxis(worldmap->chart()->axes(Qt::Horizontal).back());
-               satelliteMarker->attachAxis(worldmap->chart()->axes(Qt::Vertical).back());
-               worldmap->chart()->removeSeries(series.at(i));
-               name =name.remove(0,3);
-               for(SatelliteForGUI &sat : satellites) {
-                   QString Satname = QString::fromStdString(sat.getName());
-                   if(Satname == name) {
-                      satelliteMarker->setName("mrk" + name);
-                      CoordGeodetic pos = sat.getPosition(t.AddMinutes(scanDur/60));
-                      satelliteMarker->append(pos.longitude*180/3.141592653589793,pos.latitude*180/3.141592653589793);
-                      break;
-                   }
-               }
-               connect(satelliteMarker,SIGNAL(hovered(QPointF,bool)),this,SLOT(sattrack_hovered(QPointF,bool)));
-            }
-        }
-    }
+    updateTrackMarkers();
 }
 
 void SatelliteScheduling::worldmap_hovered(QPointF point, bool state)
@@ -296,20 +251,19 @@ void SatelliteScheduling::worldmap_hovered(QPointF point, bool state)
     if (state)
     {
         QString sta;
-        for(size_t i = 0; i<satelliteScheduler.refNetwork().refStations().size();++i){
-            double x = satelliteScheduler.refNetwork().refStations().at(i).getPosition()->getLon()*180/3.141592653589793;
-            double y = satelliteScheduler.refNetwork().refStations().at(i).getPosition()->getLat()*180/3.141592653589793;
-            QString name = QString::fromStdString(satelliteScheduler.refNetwork().refStations().at(i).getName());
-            QString id = QString::fromStdString(satelliteScheduler.refNetwork().refStations().at(i).getAlternativeName());
-
-            auto dx = x-point.x();
-            auto dy = y-point.y();
-            if(dx*dx+dy*dy < 1e-3) {
-                if(sta.size()==0) {
-                    sta.append(QString("%1 (%2)").arg(name).arg(id));
-                } else {
-                    sta.append(",").append(QString("%1 (%2)").arg(name).arg(id));
-                }
+        const auto &stations = satelliteScheduler.refNetwork().refStations();
+        // points of selectedStations are in network order, the index is rebuilt whenever they change
+        for(int i : stationHoverIndex->within(selectedStations, point, 1e-3)) {
+            if(i >= static_cast<int>(stations.size())) {
+                continue;
+            }
+            QString name = QString::fromStdString(stations.at(i).getName());
+            QString id = QString::fromStdString(stations.at(i).getAlternativeName());
+
+            if(sta.size()==0) {
+                sta.append(QString("%1 (%2)").arg(name).arg(id));
+            } else {
+                sta.append(",").append(QString("%1 (%2)").arg(name).arg(id));
             }
         }
         QString lon = QString().sprintf("lon: %.2f [deg]\n", point.x());
@@ -365,11 +319,9 @@ void SatelliteScheduling::on_pushButton_process_clicked()
     }
 
     for (const auto &selectedSatellitesName : selectedSatellitesNames) {
-        for (const auto &sat : satellites) {
-            if (sat.hasName(selectedSatellitesName)){
-                selectedSatellites.push_back(sat);
-                break;
-            }
+        int idx = catalog_->findName(selectedSatellitesName);
+        if (idx != -1){
+            selectedSatellites.push_back(satellites[idx]);
         }
     }
 
@@ -380,16 +332,21 @@ void SatelliteScheduling::on_pushButton_process_clicked()
         any.referencePARA().systemDelay = fieldSystem;
     }
 
-    auto scans = satelliteScheduler.generateScanList(selectedSatellites);
+    SatelliteProgress progress;
+    auto scans = qtUtil::runWithProgress("computing satellite passes...", progress, this, computation_, [&](){
+        return satelliteScheduler.generateScanList(selectedSatellites, &progress);
+    });
+    if(progress.canceled){
+        return;
+    }
+    candidateScans_ = scans;
 
     for (const auto &scan : scans) {
         QTreeWidgetItem *twi = new QTreeWidgetItem();
         QString srcname;
-        for(const auto &sat : selectedSatellites){
-            if(sat.getId() == scan.getSourceId()){
-                srcname = QString::fromStdString(sat.getName());
-                break;
-            }
+        int idx = catalog_->findId(scan.getSourceId());
+        if(idx != -1){
+            srcname = QString::fromStdString(satellites[idx].getName());
         }
         twi->setIcon(0,QIcon(":/icons/icons/satellite.png"));
         twi->setText(0,srcname);
@@ -433,11 +390,9 @@ void SatelliteScheduling::writeLists()
     for (const auto &scan : scheduledScans) {
         QTreeWidgetItem *twi = new QTreeWidgetItem();
         QString srcname;
-        for(const auto &sat : satellites){
-            if(sat.getId() == scan.getSourceId()){
-                srcname = QString::fromStdString(sat.getName());
-                break;
-            }
+        int idx = catalog_->findId(scan.getSourceId());
+        if(idx != -1){
+            srcname = QString::fromStdString(satellites[idx].getName());
         }
         twi->setIcon(0,QIcon(":/icons/icons/satellite.png"));
         twi->setText(0,srcname);
@@ -491,6 +446,11 @@ void SatelliteScheduling::on_pushButton_showConstant_clicked()
         int preob = dialog->getValues().at(1);
         ui->spinBox_fs->setValue(fs);
         ui->spinBox_preob->setValue(preob);
+
+        // passes are cached, only the scans are rebuilt with the new times
+        if(ui->stackedWidget->currentIndex() == 1){
+            on_pushButton_process_clicked();
+        }
     }
     delete(dialog);
 }
@@ -652,8 +612,122 @@ void SatelliteScheduling::on_treeWidget_template_itemClicked(QTreeWidgetItem *it
         connect(start, &QDateTimeEdit::dateTimeChanged, eval_start);
         connect(end,   &QDateTimeEdit::dateTimeChanged, eval_end);
         connect(sp, QOverload<int>::of(&QSpinBox::valueChanged), eval_dur);
+
+        // live validation, only the edited row is updated
+        auto validate = [this, i](){
+            updateAdjustRow(i);
+            updateAdjustStatus();
+        };
+        connect(start, &QDateTimeEdit::dateTimeChanged, this, validate);
+        connect(end, &QDateTimeEdit::dateTimeChanged, this, validate);
+        connect(cb, &QCheckBox::stateChanged, this, validate);
     }
     t->resizeColumnsToContents();
+    resetAdjustValidator();
+}
+
+void SatelliteScheduling::resetAdjustValidator()
+{
+    QTableWidget *tw = ui->tableWidget_adjust;
+    adjustValidator_.reset(tw->rowCount());
+
+    // pass windows of the adjusted satellite, widened to full seconds because the table only shows full seconds
+    int idx = catalog_->findName(ui->label_adjustSatName->text().toStdString());
+    if(idx != -1){
+        std::shared_ptr<const SatelliteMain::SatellitePasses> passes = satelliteScheduler.getPasses(satellites[idx]);
+        if(passes){
+            DateTime start = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
+            const auto &stations = satelliteScheduler.refNetwork().getStations();
+            for(size_t i=0; i<passes->passList.size(); ++i){
+                std::vector<SatelliteScanValidator::Interval> windows;
+                for(const auto &pass : passes->passList[i]){
+                    windows.push_back({static_cast<long>(std::floor((pass.start-start).TotalSeconds())),
+                                       static_cast<long>(std::ceil((pass.end-start).TotalSeconds()))});
+                }
+                adjustValidator_.setPassWindows(stations[i].getId(), windows);
+            }
+        }
+    }
+
+    std::map<unsigned long, std::vector<SatelliteScanValidator::Interval>> scheduled;
+    for(const auto &scan : scheduledScans){
+        for(unsigned long i=0; i<scan.getNSta(); ++i){
+            const VieVS::PointingVector &pvStart = scan.getPointingVector(i,VieVS::Timestamp::start);
+            const VieVS::PointingVector &pvEnd = scan.getPointingVector(i,VieVS::Timestamp::end);
+            scheduled[pvStart.getStaid()].push_back({static_cast<long>(pvStart.getTime()), static_cast<long>(pvEnd.getTime())});
+        }
+    }
+    for(auto &any : scheduled){
+        adjustValidator_.setScheduled(any.first, std::move(any.second));
+    }
+
+    for(int i=0; i<tw->rowCount(); ++i){
+        updateAdjustRow(i);
+    }
+    updateAdjustStatus();
+}
+
+void SatelliteScheduling::updateAdjustRow(int row)
+{
+    QTableWidget *tw = ui->tableWidget_adjust;
+    if(row >= tw->rowCount()){
+        return;
+    }
+    QCheckBox *cb = qobject_cast<QCheckBox *>(tw->cellWidget(row,0)->layout()->itemAt(0)->widget());
+    QTableWidgetItem *staItem = tw->item(row,1);
+    unsigned long staid = satelliteScheduler.refNetwork().getStation(staItem->text().toStdString()).getId();
+    QDateTime sessionStart = ui->dateTimeEdit_sessionStart->dateTime();
+    long start = sessionStart.secsTo(qobject_cast<QDateTimeEdit *>(tw->cellWidget(row,2))->dateTime());
+    long end = sessionStart.secsTo(qobject_cast<QDateTimeEdit *>(tw->cellWidget(row,3))->dateTime());
+    adjustValidator_.setRow(row, staid, start, end, cb->checkState() == Qt::Checked);
+
+    unsigned char flags = adjustValidator_.getRowFlags(row);
+    QStringList problems;
+    if(flags & SatelliteScanValidator::outsidePass){
+        problems << "satellite is not visible during the whole interval";
+    }
+    if(flags & SatelliteScanValidator::overlapsScheduled){
+        problems << "overlap with a scheduled scan";
+    }
+    staItem->setBackground(problems.isEmpty() ? QBrush() : QBrush(Qt::red));
+    staItem->setToolTip(problems.join("\n"));
+}
+
+void SatelliteScheduling::updateAdjustStatus()
+{
+    QLabel *label = ui->label_adjustStatus;
+    if(ui->tableWidget_adjust->rowCount() == 0){
+        label->clear();
+        return;
+    }
+
+    QString txt;
+    if(adjustValidator_.numberOfActiveRows() < 2){
+        txt = "less than two stations selected";
+    }else{
+        std::vector<SatelliteScanValidator::Interval> uncovered = adjustValidator_.getUncoveredIntervals();
+        if(!uncovered.empty()){
+            QDateTime sessionStart = ui->dateTimeEdit_sessionStart->dateTime();
+            txt = QString("station observing alone from %1 to %2")
+                    .arg(sessionStart.addSecs(uncovered.front().start).toString("hh:mm:ss"))
+                    .arg(sessionStart.addSecs(uncovered.front().end).toString("hh:mm:ss"));
+            if(uncovered.size() > 1){
+                txt.append(QString(" (and %1 more intervals)").arg(uncovered.size()-1));
+            }
+        }else if(!adjustValidator_.isValid()){
+            txt = "invalid observing times of marked stations";
+        }
+    }
+
+    QPalette pal = label->palette();
+    if(txt.isEmpty()){
+        txt = QString("valid scan with %1 stations").arg(adjustValidator_.numberOfActiveRows());
+        pal.setColor(label->foregroundRole(), Qt::darkGreen);
+    }else{
+        pal.setColor(label->foregroundRole(), Qt::red);
+    }
+    label->setPalette(pal);
+    label->setText(txt);
 }
 
 void SatelliteScheduling::on_pushButton_checkAndSave_clicked()
@@ -692,104 +766,60 @@ void SatelliteScheduling::on_pushButton_checkAndSave_clicked()
         //int fieldSystem = ui->spinBox_fs->value();
         //int preob = ui->spinBox_preob->value();
     }
-    int idx = allSatelliteModel->findItems(ui->label_adjustSatName->text()).at(0)->row();
+    int idx = catalog_->findName(ui->label_adjustSatName->text().toStdString());
+    if(idx == -1){
+        return;
+    }
     satellite = satellites[idx];
-    DateTime start = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
-    std::vector<bool> isobs(selectedStationIds.size(),false);
-    std::vector<SatelliteObs::TimePoint> timePoints;
-    for(size_t i=0;i<selectedStationIds.size(); i++) {
-        VieVS::Station station = satelliteScheduler.refNetwork().getStation(selectedStationIds.at(i));
-        SatelliteObs::TimePoint tstart;
-        tstart.ts = VieVS::Timestamp ::start;
-        tstart.time = start.AddSeconds(startTimes.at(i));
-        tstart.satelliteID = satellite.getId();
-        tstart.stationID = i;
-        timePoints.push_back(tstart);
-
-        SatelliteObs::TimePoint tend;
-        tend.ts = VieVS::Timestamp ::end;
-        tend.time = start.AddSeconds(endTimes.at(i));
-        tend.satelliteID = satellite.getId();
-        tend.stationID = i;
-        timePoints.push_back(tend);
-    }
-    std::sort(timePoints.begin(), timePoints.end(), SatelliteObs::compareTimePoint);
-    if(timePoints.size() == 2) {
+
+    // rows are validated live while they are edited
+    if(adjustValidator_.numberOfActiveRows() < 2) {
        QMessageBox::information(this,"no valid scan","There is only one station selected! No valid Scan!");
        return;
     }
-    if(timePoints.at(0).time == timePoints.at(1).time) {
-       unsigned long staID_0 = timePoints.at(0).stationID;
-       isobs.at(staID_0) = true;
-       unsigned long staID_1 = timePoints.at(1).stationID;
-       isobs.at(staID_1) = true;
-    }
-    else {
+    if(!adjustValidator_.getUncoveredIntervals().empty()) {
         QMessageBox::information(this,"no valid scan","There is a station observing alone!");
         return;
     }
-    for(size_t i =2; i<timePoints.size();i++) {
-        unsigned long staID = timePoints.at(i).stationID;
-        if(timePoints.at(i).ts == VieVS::Timestamp::start)
-        {
-            isobs.at(staID) = true;
-        }
-        if(timePoints.at(i).ts == VieVS::Timestamp::end)
-        {
-            isobs.at(staID) = false;
-        }
-        if(count(isobs.begin(), isobs.end(), true) <2)
-        {
-            if(i == timePoints.size()-2 && timePoints.at(i).time == timePoints.at(timePoints.size()-1).time) {
-                break;
-            }
-            QMessageBox::information(this,"no valid scan","There is a station observing alone !");
-            return;
-        }
-    }
-    VieVS::Scan scan = satelliteScheduler.createAdjustedScan(satellite,selectedStationIds,startTimes,endTimes);
-    if(checkScan(scan))
-    {
-       scheduledScans.push_back(scan);
-       QMessageBox::information(this,"Scan added","The scan was successfully added to the schedule!");
+    unsigned char flags = 0;
+    for(int i = 0; i<tw->rowCount(); ++i){
+        flags |= adjustValidator_.getRowFlags(i);
     }
-    else
-    {
+    if(flags & SatelliteScanValidator::overlapsScheduled) {
         QMessageBox::information(this,"overlap in observing time","There is an overlap with a scheduled Scan!");
         return;
     }
+    if(flags & SatelliteScanValidator::outsidePass) {
+        QMessageBox::information(this,"no valid scan","The satellite is not visible from all stations during the selected times!");
+        return;
+    }
+
+    VieVS::Scan scan = satelliteScheduler.createAdjustedScan(satellite,selectedStationIds,startTimes,endTimes);
+    scheduledScans.push_back(scan);
+    QMessageBox::information(this,"Scan added","The scan was successfully added to the schedule!");
+    resetAdjustValidator();
     ui->label_numScans->setText(QString::number(scheduledScans.size()));
 }
 
-bool SatelliteScheduling::checkScan(VieVS::Scan scan)
+void SatelliteScheduling::on_pushButton_autoSelect_clicked()
 {
-    bool ret = true;
-    for(VieVS::Scan scheduledScan : scheduledScans)
-    {
-        unsigned long nSta = scheduledScan.getNSta();
-        for(int i =0 ; i<nSta; i++)
-        {
-            VieVS::PointingVector pvSchedScanStart = scheduledScan.getPointingVector(i,VieVS::Timestamp::start);
-            VieVS::PointingVector pvSchedScanEnd = scheduledScan.getPointingVector(i,VieVS::Timestamp::end);
-            for(int k = 0; k<scan.getNSta();k++) {
-                VieVS::PointingVector pvScanStart = scan.getPointingVector(k,VieVS::Timestamp::start);
-                VieVS::PointingVector pvScanEnd = scan.getPointingVector(k,VieVS::Timestamp::end);
-                if(pvSchedScanStart.getStaid() == pvScanStart.getStaid()) {
-                    if(pvScanEnd.getTime() < pvSchedScanStart.getTime() || pvScanStart.getTime() > pvSchedScanEnd.getTime()) {
-                       continue;
-                    }
-                    else {
-                       ret = false;
-                       return ret;
-                    }
-                }
-                else {
-                    continue;
-                }
-            }
-        }
+    if(candidateScans_.empty()){
+        QMessageBox::information(this,"no scans","There are no scans to select from!");
+        return;
+    }
+
+    SatelliteScanAssembler assembler(satelliteScheduler.refNetwork());
+    std::vector<int> selected = assembler.assemble(candidateScans_, {}, scheduledScans);
+    for(int idx : selected){
+        scheduledScans.push_back(candidateScans_[idx]);
     }
-    return ret;
+    std::sort(scheduledScans.begin(), scheduledScans.end(), [](const VieVS::Scan &a, const VieVS::Scan &b){
+        return a.getTimes().getScanTime(VieVS::Timestamp::start) < b.getTimes().getScanTime(VieVS::Timestamp::start);
+    });
+
+    resetAdjustValidator();
+    ui->label_numScans->setText(QString::number(scheduledScans.size()));
+    QMessageBox::information(this,"Scans added",QString("%1 conflict free scans were added to the schedule!").arg(selected.size()));
 }
 
 void SatelliteScheduling::on_pushButton_removeScan_clicked()
@@ -800,81 +830,148 @@ void SatelliteScheduling::on_pushButton_removeScan_clicked()
             delete(any);
             scheduledScans.erase(scheduledScans.begin() + index.row());
         }
+        resetAdjustValidator();
 }
 
 void SatelliteScheduling::on_checkBox_showTracks_clicked(bool checked)
 {
-    QChart *worldChart = worldmap->chart();
-    auto series = worldChart->series();
-    for(int i =0; i<series.size();i++) {
-        QString name = series.at(i)->name();
-        if(name.left(3)=="mrk" || name.left(3)=="sat") {
-             worldChart->removeSeries(series.at(i));
+    if(!checked) {
+        for(const auto &tracks : trackSeries_) {
+            for(QLineSeries *track : tracks) {
+                track->setVisible(false);
+            }
+        }
+        for(QScatterSeries *marker : trackMarkers_) {
+            marker->setVisible(false);
         }
+        return;
     }
-    long sessionDur = sessionStart_.secsTo(sessionEnd_);
-    if(checked)
-    {
-        for( int i=0; i< selectedSatelliteModel->rowCount(); i++){
-            QString name = selectedSatelliteModel->item(i)->text();
-            QScatterSeries *satelliteTrack = new QScatterSeries(worldChart);
-            satelliteTrack->clear();
-            satelliteTrack->setName("sat" + name);
-            satelliteTrack->setBrush(QBrush(QColor(228,26,28),Qt::SolidPattern));
-            satelliteTrack->setMarkerSize(2);
-            satelliteTrack->setPen(QColor(228,26,28));
-            satelliteTrack->setOpacity(0.5);
-
-            QScatterSeries *satelliteMarker = new QScatterSeries(worldChart);
-            satelliteMarker->clear();
-            satelliteMarker->setName("mrk" + name);
-            QImage img(":/icons/icons/satellite.png");
-            satelliteMarker->setBrush(QBrush(img));
-            satelliteMarker->setMarkerShape(QScatterSeries::MarkerShapeRectangle);
-            satelliteMarker->setMarkerSize(40);
-            satelliteMarker->setPen(QColor(Qt::transparent));
-
-            for(SatelliteForGUI &sat : satellites)
-            {
-                QString Satname = QString::fromStdString(sat.getName());
-                if(Satname == name) {
-                   int scanDur = sessionStart_.secsTo(ui->dateTimeEdit_showTime->dateTime());
-                   DateTime t = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
-                   CoordGeodetic pos = sat.getPosition(t);
-                   for(int i = 0;i<sessionDur/60; i++) //each Minute
-                   {
-                       pos = sat.getPosition(t.AddMinutes(i));
-                       satelliteTrack->append(pos.longitude*180/pi,pos.latitude*180/pi);
-                   }
-                   pos = sat.getPosition(t.AddMinutes(scanDur/60));
-                   satelliteMarker->append(pos.longitude*180/pi,pos.latitude*180/pi);
-
-                   connect(satelliteMarker,SIGNAL(hovered(QPointF,bool)),this,SLOT(sattrack_hovered(QPointF,bool)));
-                }
-            }
-            worldChart->addSeries(satelliteTrack);
-            worldChart->addSeries(satelliteMarker);
-            satelliteTrack->attachAxis(worldChart->axes(Qt::Horizontal).back());
-            satelliteTrack->attachAxis(worldChart->axes(Qt::Vertical).back());
-            satelliteMarker->attachAxis(worldChart->axes(Qt::Horizontal).back());
-            satelliteMarker->attachAxis(worldChart->axes(Qt::Vertical).back());
+
+    QSet<QString> selected;
+    for( int i=0; i< selectedSatelliteModel->rowCount(); i++){
+        selected.insert(selectedSatelliteModel->item(i)->text());
+    }
+    for(const QString &name : trackSeries_.keys()) {
+        if(!selected.contains(name)) {
+            removeGroundTrack(name);
         }
-        worldmap->setChart(worldChart);
-   }
-   else
-   {
-        auto series = worldmap->chart()->series();
-        for(int i=0; i<series.count();++i)  {
-            QString name = series.at(i)->name();
-            name.remove(0, 3);
-            for(SatelliteForGUI &sat : satellites) {
-                QString Satname = QString::fromStdString(sat.getName());
-                if(Satname == name) {
-                   series.at(i)->setVisible(false);
-                }
+    }
+
+    // show cached tracks, collect the satellites whose tracks still have to be computed
+    std::vector<SatelliteForGUI> missing;
+    for(const QString &name : selected) {
+        if(trackSeries_.contains(name)) {
+            for(QLineSeries *track : trackSeries_[name]) {
+                track->setVisible(true);
             }
+            trackMarkers_[name]->setVisible(true);
+        } else if(groundTracks_.contains(name)) {
+            addGroundTrack(name);
+        } else if(catalog_->findName(name.toStdString()) != -1) {
+            missing.push_back(satellites[catalog_->findName(name.toStdString())]);
         }
-   }
+    }
+    updateTrackMarkers();
+
+    // a running computation calls this function again when it is finished
+    if(missing.empty() || trackWatcher_->isRunning()) {
+        return;
+    }
+    DateTime start = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
+    long sessionDur = sessionStart_.secsTo(sessionEnd_);
+    trackWatcher_->setFuture(QtConcurrent::run([missing, start, sessionDur](){
+        GroundTracks tracks;
+        for(const auto &sat : missing) {
+            tracks.insert(QString::fromStdString(sat.getName()), computeGroundTrack(sat, start, sessionDur, 60));
+        }
+        return tracks;
+    }));
+}
+
+void SatelliteScheduling::groundTracksFinished()
+{
+    GroundTracks tracks = trackWatcher_->result();
+    for(auto it = tracks.constBegin(); it != tracks.constEnd(); ++it) {
+        groundTracks_.insert(it.key(), it.value());
+    }
+    if(ui->checkBox_showTracks->isChecked()) {
+        on_checkBox_showTracks_clicked(true);
+    }
+}
+
+QVector<QVector<QPointF>> SatelliteScheduling::computeGroundTrack(SatelliteForGUI sat, DateTime start, long duration, int step)
+{
+    QVector<QVector<QPointF>> segments(1);
+    QPointF last;
+    for(long t = 0; t <= duration; t += step) {
+        CoordGeodetic pos = sat.getPosition(start.AddSeconds(t));
+        QPointF p(pos.longitude*rad2deg, pos.latitude*rad2deg);
+        if(!segments.last().isEmpty() && std::abs(p.x()-last.x()) > 180) {
+            // crossing the antimeridian: close this segment at +-180 deg and start the next one on the other side
+            double lon = p.x() + (p.x() < last.x() ? 360 : -360);
+            double edge = lon > last.x() ? 180 : -180;
+            double lat = last.y() + (edge-last.x())/(lon-last.x())*(p.y()-last.y());
+            segments.last().append(QPointF(edge, lat));
+            segments.append(QVector<QPointF>{QPointF(-edge, lat)});
+        }
+        segments.last().append(p);
+        last = p;
+    }
+    return segments;
+}
+
+void SatelliteScheduling::addGroundTrack(const QString &name)
+{
+    QChart *worldChart = worldmap->chart();
+    QList<QLineSeries *> tracks;
+    for(const auto &segment : groundTracks_.value(name)) {
+        QLineSeries *track = new QLineSeries(worldChart);
+        track->setName("sat" + name);
+        track->setPen(QPen(QColor(228,26,28), 1.5));
+        track->setOpacity(0.5);
+        track->replace(segment);
+        worldChart->addSeries(track);
+        track->attachAxis(worldChart->axes(Qt::Horizontal).back());
+        track->attachAxis(worldChart->axes(Qt::Vertical).back());
+        tracks.append(track);
+    }
+    trackSeries_.insert(name, tracks);
+
+    QScatterSeries *satelliteMarker = new QScatterSeries(worldChart);
+    satelliteMarker->setName("mrk" + name);
+    QImage img(":/icons/icons/satellite.png");
+    satelliteMarker->setBrush(QBrush(img));
+    satelliteMarker->setMarkerShape(QScatterSeries::MarkerShapeRectangle);
+    satelliteMarker->setMarkerSize(40);
+    satelliteMarker->setPen(QColor(Qt::transparent));
+    worldChart->addSeries(satelliteMarker);
+    satelliteMarker->attachAxis(worldChart->axes(Qt::Horizontal).back());
+    satelliteMarker->attachAxis(worldChart->axes(Qt::Vertical).back());
+    connect(satelliteMarker,SIGNAL(hovered(QPointF,bool)),this,SLOT(sattrack_hovered(QPointF,bool)));
+    trackMarkers_.insert(name, satelliteMarker);
+}
+
+void SatelliteScheduling::removeGroundTrack(const QString &name)
+{
+    QChart *worldChart = worldmap->chart();
+    for(QLineSeries *track : trackSeries_.take(name)) {
+        worldChart->removeSeries(track);
+        delete track;
+    }
+    if(QScatterSeries *marker = trackMarkers_.take(name)) {
+        worldChart->removeSeries(marker);
+        delete marker;
+    }
+}
+
+void SatelliteScheduling::updateTrackMarkers()
+{
+    DateTime t = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
+    t = t.AddSeconds(sessionStart_.secsTo(ui->dateTimeEdit_showTime->dateTime()));
+    for(auto it = trackMarkers_.begin(); it != trackMarkers_.end(); ++it) {
+        CoordGeodetic pos = satellites[catalog_->findName(it.key().toStdString())].getPosition(t);
+        it.value()->replace(QVector<QPointF>{QPointF(pos.longitude*rad2deg, pos.latitude*rad2deg)});
+    }
 }
 
 void SatelliteScheduling::on_checkBox_showStations_clicked(bool checked)
@@ -991,11 +1088,11 @@ void SatelliteScheduling::updateSkyPlotScan(QString name)
     QTreeWidgetItem *itm = ui->treeWidget_selectedScanPlots->topLevelItem(idxTopLevelItem);
     QString Satellitename = itm->data(0,0).toString();
 
-    SGP4 *sgp4 = nullptr;
+    std::shared_ptr<const SatelliteEphemeris> eph;
     for(SatelliteForGUI &sat : satellites) {
         QString Satname = QString::fromStdString(sat.getName());
         if(Satellitename == Satname) {
-            sgp4 = sat.getSGP4Data();
+            eph = sat.getEphemeris();
         }
     }
     QDateTime start = ui->dateTimeEdit_sessionStart->dateTime();
@@ -1082,12 +1179,12 @@ void SatelliteScheduling::updateSkyPlotScan(QString name)
             while(j <scanDur) //scanDur in sec, every second a point
             {
                DateTime tp = t.AddSeconds(j);
-               Eci eci = sgp4->FindPosition(tp);
+               Eci eci = eph->FindPosition(tp);
                CoordTopocentric topo = obs.GetLookAngle(eci);
                data->append(topo.azimuth*rad2deg,90-(topo.elevation*rad2deg));
                j = j+10;
             }
-            Eci eci = sgp4->FindPosition(t.AddSeconds(scanDur));
+            Eci eci = eph->FindPosition(t.AddSeconds(scanDur));
             CoordTopocentric topo = obs.GetLookAngle(eci);
             data->append(topo.azimuth*rad2deg,90-(topo.elevation*rad2deg));
             data->setName(station);
@@ -1164,11 +1261,11 @@ void SatelliteScheduling::createElevationPlotScan(int idxTopLevelItem)
     QTreeWidgetItem *a = ui->treeWidget_selectedScanPlots->topLevelItem(idxTopLevelItem);
     QString Satellitename = a->data(0,0).toString();
     chartView->chart()->setTitle(Satellitename);
-    SGP4 *sgp4 = nullptr;
+    std::shared_ptr<const SatelliteEphemeris> eph;
     for(SatelliteForGUI &sat : satellites) {
         QString Satname = QString::fromStdString(sat.getName());
         if(Satellitename == Satname) {
-            sgp4 = sat.getSGP4Data();
+            eph = sat.getEphemeris();
         }
     }
     const VieVS::Network &network = satelliteScheduler.refNetwork(); //.refStations() //.getNetwork();
@@ -1222,7 +1319,7 @@ void SatelliteScheduling::createElevationPlotScan(int idxTopLevelItem)
                 while(counter<sessionDur)
                 {
                     QDateTime ts = sessionStart_.addSecs(counter);
-                    Eci eci = sgp4->FindPosition(t.AddSeconds(counter));
+                    Eci eci = eph->FindPosition(t.AddSeconds(counter));
                     CoordTopocentric topo = obs.GetLookAngle(eci);
                     serie->append(ts.toMSecsSinceEpoch(),topo.elevation*rad2deg);
                     counter=counter+600;
@@ -1243,7 +1340,7 @@ void SatelliteScheduling::createElevationPlotScan(int idxTopLevelItem)
                 while(counter<scanDur)
                 {
                     QDateTime ts = start.addSecs(counter);
-                    Eci eci = sgp4->FindPosition(t.AddSeconds(counter));
+                    Eci eci = eph->FindPosition(t.AddSeconds(counter));
                     CoordTopocentric topo = obs.GetLookAngle(eci);
                     serie->append(ts.toMSecsSinceEpoch(),topo.elevation*rad2deg);
                     counter=counter+10;
@@ -1268,6 +1365,10 @@ void SatelliteScheduling::ElevationSetup()
     ui->splitter_satelliteElevation->setStretchFactor(1,4);
     ui->splitter_satelliteElevation->setSizes({700,2000});
 
+    ui->spinBox_elevationStep->blockSignals(true);
+    ui->spinBox_elevationStep->setValue(settings_->get<int>("settings.satellite.elevationStep",30));
+    ui->spinBox_elevationStep->blockSignals(false);
+
     QChart *chart = new QChart();
 
     QDateTimeAxis *axisX = new QDateTimeAxis;
@@ -1290,7 +1391,8 @@ void SatelliteScheduling::ElevationSetup()
     axisY->setLabelsFont(labelsFont);
     axisX->setLabelsFont(labelsFont);
 
-    QChartView *chartView = new QChartView(chart);
+    ChartView *chartView = new ChartView(chart);
+    chartView->setRubberBand(QChartView::HorizontalRubberBand);
     chartView->setRenderHint(QPainter::Antialiasing);
 
     QList<QColor> c;
@@ -1305,6 +1407,7 @@ void SatelliteScheduling::ElevationSetup()
     c.append(QColor(153,153,153));
 
     const VieVS::Network &network = satelliteScheduler.refNetwork();
+    elevationSeries_.clear();
     for(int i=0; i<network.getNSta(); ++i){
         QString name = QString::fromStdString(network.getStation(i).getName());
         QLineSeries *series = new QLineSeries();
@@ -1312,6 +1415,7 @@ void SatelliteScheduling::ElevationSetup()
         chart->addSeries(series);
         series->attachAxis(axisX);
         series->attachAxis(axisY);
+        elevationSeries_.append(series);
         int nc = i/9;
         int cc = i%9;
         if(nc == 0) {
@@ -1334,6 +1438,7 @@ void SatelliteScheduling::ElevationSetup()
     callout->hide();
 
     ui->ElevationPlot->insertWidget(0,chartView,1);
+    elevationDownsampler = new SeriesDownsampler(chart);
     connect(ui->treeView_satellites->selectionModel(),SIGNAL(selectionChanged(QItemSelection,QItemSelection)),SLOT(updateElevation()));
 }
 
@@ -1344,41 +1449,61 @@ void SatelliteScheduling::updateElevation()
 
     //get seleted item
     QModelIndexList sel = ui->treeView_satellites->selectionModel()->selectedRows();
+    if(sel.isEmpty()) {
+        return;
+    }
     QString name = ui->treeView_satellites->model()->data(sel.at(0)).toString();
-
-    int idx = allSatelliteModel->findItems(name).at(0)->row();
+    int idx = catalog_->findName(name.toStdString());
+    if(idx == -1) {
+        return;
+    }
 
     chart->setTitle(name);
-    SatelliteForGUI &sat = satellites[idx];
-    SGP4 *sgp4 = sat.getSGP4Data();
-    std::vector<VieVS::Station> stations = satelliteScheduler.refNetwork().getStations();
+    auto it = elevationCache_.find(name);
+    if(it == elevationCache_.end()) {
+        it = elevationCache_.insert(name, computeElevations(satellites[idx], ui->spinBox_elevationStep->value()));
+    }
+    const auto &curves = it.value();
+    for(int i=0; i<elevationSeries_.size(); ++i) {
+        elevationDownsampler->setData(elevationSeries_.at(i), curves.at(i));
+    }
+    chart->legend()->setMarkerShape(QLegend::MarkerShapeFromSeries);
+}
 
-    int scanDur = sessionStart_.secsTo(sessionEnd_);
-    auto series = chart->series();
+std::vector<QVector<QPointF>> SatelliteScheduling::computeElevations(const SatelliteForGUI &sat, int step)
+{
+    std::shared_ptr<const SatelliteEphemeris> eph = sat.getEphemeris();
+    const std::vector<VieVS::Station> &stations = satelliteScheduler.refNetwork().getStations();
+    int nsta = static_cast<int>(stations.size());
 
-    for(VieVS::Station &sta : stations) {
-        QLineSeries *serie;
-        for(const auto &any:series){
-            if(any->name() == QString::fromStdString(sta.getName())){
-                serie = qobject_cast<QLineSeries *>(any);
-                break;
-            }
-        }
-        serie->clear();
+    int scanDur = sessionStart_.secsTo(sessionEnd_);
+    DateTime t = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
+    qint64 t0 = sessionStart_.toMSecsSinceEpoch();
 
+    // stations are independent, the ephemeris is shared read-only
+    std::vector<QVector<QPointF>> curves(nsta);
+    #pragma omp parallel for schedule(dynamic)
+    for(int i=0; i<nsta; ++i) {
+        const VieVS::Station &sta = stations[i];
         CoordGeodetic stat = CoordGeodetic(sta.getPosition()->getLat(),sta.getPosition()->getLon(),sta.getPosition()->getAltitude()/1000,true);
         Observer obs( stat );
-        DateTime t = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
-        int counter = 0;
-        while(counter<scanDur) {
-            QDateTime ts = sessionStart_.addSecs(counter);
-            Eci eci = sgp4->FindPosition(t.AddSeconds(counter));
+        QVector<QPointF> points;
+        points.reserve(scanDur/step+1);
+        for(int counter=0; counter<scanDur; counter+=step) {
+            Eci eci = eph->FindPosition(t.AddSeconds(counter));
             CoordTopocentric topo = obs.GetLookAngle(eci);
-            serie->append(ts.toMSecsSinceEpoch(),topo.elevation*rad2deg);
-            counter=counter+600;
+            points.append(QPointF(t0+counter*1000LL,topo.elevation*rad2deg));
         }
+        curves[i] = std::move(points);
     }
-    chart->legend()->setMarkerShape(QLegend::MarkerShapeFromSeries);
+    return curves;
+}
+
+void SatelliteScheduling::on_spinBox_elevationStep_valueChanged(int step)
+{
+    settings_->put("settings.satellite.elevationStep", step);
+    elevationCache_.clear();
+    updateElevation();
 }
 
 void SatelliteScheduling::StackedBarPlotSetup()
@@ -1516,8 +1641,21 @@ void SatelliteScheduling::satelliteStatisticsSetup()
 }*/
 
 
+bool SatelliteScheduling::computeAllPasses()
+{
+    SatelliteProgress progress;
+    return qtUtil::runWithProgress("computing satellite passes...", progress, this, computation_, [&](){
+        return satelliteScheduler.computePasses(satellites, &progress);
+    });
+}
+
 void SatelliteScheduling::createBarPlotStackedTableVisibility()
 {
+    // coverage of all satellites, only computed once per satellite
+    if(!computeAllPasses()){
+        return;
+    }
+
     //general
     VieVS::Network &network = satelliteScheduler.refNetwork();
     int nSta = network.getNSta();
@@ -1532,17 +1670,14 @@ void SatelliteScheduling::createBarPlotStackedTableVisibility()
     QValueAxis *axisY = qobject_cast<QValueAxis *>(barChart->axisY());
     QBarCategoryAxis *axisX = qobject_cast<QBarCategoryAxis *>(barChart->axisX());
     QStringList labels;
-    for(int i =0; i<satellites.size(); i++)
+    for(const auto &sat : satellites)
     {
-        SatelliteForGUI sat = satellites.at(i);
-        QString name = QString::fromStdString(sat.getName());
-        labels << name;
-   }
+        labels << QString::fromStdString(sat.getName());
+    }
     axisX->setCategories(labels);
     axisX->setLabelsAngle(-45);
-    QVector<QVector<double>> BarSets;
-    BarSets.clear();
-
+    // percentage per number of stations [nSta][satellite]
+    QVector<QList<qreal>> barValues(nSta+1);
 
     //Table
     MultiColumnSortFilterProxyModel *satelliteProxyTable = new MultiColumnSortFilterProxyModel(this);
@@ -1554,71 +1689,53 @@ void SatelliteScheduling::createBarPlotStackedTableVisibility()
         QString s = QString("%1 stations").arg(i);
         satelliteTable->setHeaderData(i+2, Qt::Horizontal, s);
     }
-    satelliteProxyTable->setSourceModel(satelliteTable);
-    satelliteProxyTable->setFilterCaseSensitivity(Qt::CaseInsensitive);
-    satelliteProxyTable->setFilterKeyColumns({0});
-    satelliteProxyTable->sort(0);
-    ui->treeView_satelliteListStatistics_table->setModel(satelliteProxyTable);
 
-    for(size_t i =0; i<satellites.size();i++){
-        SatelliteForGUI sat = satellites.at(i);
+    for(const auto &sat : satellites){
         QString name = QString::fromStdString(sat.getName());
         DateTime ti = sat.getTleData()->Epoch();
         QDateTime satEpoch = QDateTime(QDate(ti.Year(),ti.Month(),ti.Day()), QTime(ti.Hour(),ti.Minute(),ti.Second()));
         QStandardItem * nameItem = new QStandardItem(QIcon(":/icons/icons/satellite.png"),name);
         QStandardItem * satEpochItem = new QStandardItem(satEpoch.toString("dd.MM.yyyy hh:mm:ss"));
         QList<QStandardItem *> list;
-        list.clear();
         list.append(nameItem);
         list.append(satEpochItem);
-        std::vector<std::vector<SatelliteForGUI::SatPass>> passList = sat.generatePassList(network, start,end,60);
-        std::vector<SatelliteObs> overlaps = SatelliteObs::passList2Overlap( passList );
-        QVector<double> timesPerNSta(network.getNSta()+1,0);
-        double obsTime =0;
-        for(size_t i =0; i<overlaps.size();i++) {
-            DateTime ovStart = overlaps.at(i).getStart();
-            DateTime ovEnd = overlaps.at(i).getEnd();
-            TimeSpan ts = ovEnd - ovStart;
-            double scanDur = ts.TotalSeconds();
-            int nSta = overlaps.at(i).getNumberofStations();
-            timesPerNSta[nSta] =  timesPerNSta[nSta] +scanDur;
-            obsTime = obsTime +scanDur;
-        }
-        timesPerNSta[0]= totalObsTime - obsTime;
-        BarSets.append(timesPerNSta);
 
+        const SatelliteCoverageIndex &coverage = satelliteScheduler.getPasses(sat)->coverage;
         for(int j = 0; j<=nSta; j++) {
-           QString s = QString().sprintf("%.2f %", timesPerNSta.at(j)*100/totalObsTime);
-           QStandardItem * item = new QStandardItem(s);
-           item->setTextAlignment(Qt::AlignLeft);
-           list.append(item);
-        }
-        for(int i=0; i< ui->treeView_satelliteListStatistics_table->model()->columnCount(); ++i) {
-            ui->treeView_satelliteListStatistics_table->resizeColumnToContents(i);
-            int width = ui->treeView_satelliteListStatistics_table->columnWidth(i);
-            ui->treeView_satelliteListStatistics_table->setColumnWidth(i,width+10);
+            double percent = coverage.getCoverage(j)*100/totalObsTime;
+            barValues[j].append(percent);
+            QStandardItem * item = new QStandardItem(QString().sprintf("%.2f %", percent));
+            item->setTextAlignment(Qt::AlignLeft);
+            list.append(item);
         }
         satelliteTable->appendRow(list);
+    }
 
+    // model is filled before it is attached, so the view is only laid out once
+    satelliteProxyTable->setSourceModel(satelliteTable);
+    satelliteProxyTable->setFilterCaseSensitivity(Qt::CaseInsensitive);
+    satelliteProxyTable->setFilterKeyColumns({0});
+    satelliteProxyTable->sort(0);
+    ui->treeView_satelliteListStatistics_table->setModel(satelliteProxyTable);
+    for(int i=0; i< satelliteTable->columnCount(); ++i) {
+        ui->treeView_satelliteListStatistics_table->resizeColumnToContents(i);
+        int width = ui->treeView_satelliteListStatistics_table->columnWidth(i);
+        ui->treeView_satelliteListStatistics_table->setColumnWidth(i,width+10);
     }
-    float a = 1.5 ;
-    for(int k=0; k<=network.getNSta();k++)
+
+    for(int k=0; k<=nSta;k++)
     {
         QBarSet *barSet = barSeries->barSets().at(k);
         barSet->remove(0,barSet->count());
-        for(int i = 0; i<satellites.size();i++)
-        {
-            *barSet << BarSets.at(i).at(k)*100/totalObsTime;
-            a = BarSets.at(i).at(k)*100/totalObsTime;
-        }
+        barSet->append(barValues[k]);
     }
     axisY->setRange(0, 100);
     int show = 5;
     auto categories = axisX->categories();
-    if(BarSets.size() !=0) {
+    if(!satellites.empty()) {
         QString minlabel = categories.at(0);
         QString maxlabel;
-        if(BarSets.size()>show) {
+        if(static_cast<int>(satellites.size())>show) {
             maxlabel = categories.at(show-1);
         }
         else {
@@ -1627,8 +1744,8 @@ void SatelliteScheduling::createBarPlotStackedTableVisibility()
         axisX->setMax(minlabel);
         axisX->setMax(maxlabel);
     }
-    if(BarSets.size()>show) {
-        ui->horizontalScrollBar_stackedPlot->setRange(0,BarSets.size()-show);
+    if(static_cast<int>(satellites.size())>show) {
+        ui->horizontalScrollBar_stackedPlot->setRange(0,satellites.size()-show);
         ui->horizontalScrollBar_stackedPlot->setSingleStep(1);
     }
     else {
@@ -1731,31 +1848,23 @@ void SatelliteScheduling::updateSatelliteStatistics()
     QValueAxis *axisY = qobject_cast<QValueAxis *>(barChart->axes(Qt::Vertical).back());
     QModelIndexList sel = ui->treeView_satelliteListStatistics->selectionModel()->selectedRows();
     QString name = ui->treeView_satelliteListStatistics->model()->data(sel.at(0)).toString();
-    int idx = allSatelliteModel->findItems(name).at(0)->row();
+    int idx = catalog_->findName(name.toStdString());
+    if(idx == -1) {
+        return;
+    }
 
-    SatelliteForGUI &sat = satellites[idx];
-    VieVS::Network &network = satelliteScheduler.refNetwork();
+    const SatelliteForGUI &sat = satellites[idx];
+    if(!satelliteScheduler.computePasses({sat})){
+        return;
+    }
+    const SatelliteCoverageIndex &coverage = satelliteScheduler.getPasses(sat)->coverage;
 
     DateTime start = DateTime(sessionStart_.date().year(),sessionStart_.date().month(),sessionStart_.date().day(),sessionStart_.time().hour(),sessionStart_.time().minute(),sessionStart_.time().second());
     DateTime end = DateTime(sessionEnd_.date().year(),sessionEnd_.date().month(),sessionEnd_.date().day(),sessionEnd_.time().hour(),sessionEnd_.time().minute(),sessionEnd_.time().second());
-    int totalObsTime =(end-start).TotalSeconds();
-    std::vector<std::vector<SatelliteForGUI::SatPass>> passList = sat.generatePassList(network, start,end,60);
-    std::vector<SatelliteObs> overlaps = SatelliteObs::passList2Overlap( passList );
-    QVector<int> timesPerNSta(network.getNSta()+1,0);
-    int obsTime =0;
-    for(size_t i =0; i<overlaps.size();i++)
-    {
-        DateTime ovStart = overlaps.at(i).getStart();
-        DateTime ovEnd = overlaps.at(i).getEnd();
-        TimeSpan ts = ovEnd - ovStart;
-        int scanDur = ts.TotalSeconds();
-        int nSta = overlaps.at(i).getNumberofStations();
-        timesPerNSta[nSta] =  timesPerNSta[nSta] + scanDur;
-        obsTime = obsTime + scanDur;
-    }
-    timesPerNSta[0]= totalObsTime - obsTime;
+    double totalObsTime =(end-start).TotalSeconds();
+    const std::vector<double> &timesPerNSta = coverage.getCoveragePerNSta();
 
-    for(int any: timesPerNSta) {
+    for(double any: timesPerNSta) {
         barSet->append(any*100/totalObsTime);
     }
     double max = *std::max_element(timesPerNSta.begin(), timesPerNSta.end());
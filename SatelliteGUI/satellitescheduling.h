@@ -6,6 +6,7 @@
 #include <QFileDialog>
 #include <QStandardItemModel>
 #include <QMessageBox>
+#include <QProgressDialog>
 #include <QComboBox>
 #include <QGraphicsLayout>
 #include <QStandardItemModel>
@@ -29,10 +30,17 @@
 #include "Utility/callout.h"
 #include "Utility/qtutil.h"
 #include "Utility/multicolumnsortfilterproxymodel.h"
+#include "Utility/seriesdownsampler.h"
+#include "Utility/pointindex.h"
 
 #include "SatelliteMain.h"
+#include "SatelliteCatalog.h"
+#include "SatelliteScanAssembler.h"
+#include "SatelliteScanValidator.h"
 #include "setTimes.h"
 #include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QCloseEvent>
 
 namespace Ui {
 class SatelliteScheduling;
@@ -49,7 +57,7 @@ public:
 
     SatelliteScheduling(const QString &pathAntenna, const QString &pathEquip,
                         const QString &pathPosition, const QString &pathMask,
-                        const QString &pathSat,
+                        std::shared_ptr<const SatelliteCatalog> catalog,
                         QStandardItemModel *selectedSatelliteModel,
                         QStandardItemModel *allSatelliteModel,
                         QStandardItemModel *allSatellitePlusGroupModel,
@@ -65,6 +73,9 @@ public:
 
     unsigned long getNumberOfScans() {return scheduledScans.size();}
 
+protected:
+    void closeEvent(QCloseEvent *event) override;
+
 private slots:
     void on_actionSatellite_triggered();
     void on_actionScan_triggered();
@@ -84,6 +95,7 @@ private slots:
 
     void worldmap_hovered(QPointF point, bool state);
     void sattrack_hovered(QPointF point,bool state);
+    void groundTracksFinished();
 
     void on_pushButton_process_clicked();
 
@@ -94,14 +106,16 @@ private slots:
     void on_treeWidget_template_itemClicked(QTreeWidgetItem *item); //, int column);
 
     void on_pushButton_checkAndSave_clicked();
-    bool checkScan(VieVS::Scan scan);
 
     void on_pushButton_removeScan_clicked();
 
     void on_pushButton_adjustStart_clicked();
 
+    void on_pushButton_autoSelect_clicked();
+
     void ElevationSetup();
     void updateElevation();
+    void on_spinBox_elevationStep_valueChanged(int step);
     void satelliteStatisticsSetup();
     void updateSatelliteStatistics();
 
@@ -146,10 +160,87 @@ private:
 
     Callout *worldMapCallout;
 
-   // QVector<QScatterSeries> *SatelliteTracks;
+    SeriesPointIndex *stationHoverIndex; ///< hit-testing of selectedStations, follows changes of the network
+
+    SeriesDownsampler *elevationDownsampler; ///< full resolution elevation traces, only visible part is plotted
+
+    QList<QLineSeries *> elevationSeries_; ///< elevation series of each station (network order)
+
+    QHash<QString, std::vector<QVector<QPointF>>> elevationCache_; ///< elevation curves [station] per satellite
+
+    /**
+     * @brief elevation curves of a satellite for all stations, computed in parallel over the stations
+     *
+     * @param sat satellite
+     * @param step sampling step in seconds
+     * @return (time [ms since epoch], elevation [deg]) per station
+     */
+    std::vector<QVector<QPointF>> computeElevations(const SatelliteForGUI &sat, int step);
+
+    /**
+     * @brief ground track (lon, lat) [deg] of each satellite, split into segments at the antimeridian
+     */
+    using GroundTracks = QHash<QString, QVector<QVector<QPointF>>>;
+
+    std::shared_ptr<const SatelliteCatalog> catalog_; ///< TLE catalog shared with the main window, same order as satellites
+
+    GroundTracks groundTracks_; ///< cached ground tracks, the session is fixed for the lifetime of this window
+
+    QFutureWatcher<GroundTracks> *trackWatcher_; ///< ground track computation running in the background
+
+    QFuture<void> computation_; ///< running pass or scan computation, references satelliteScheduler
+
+    QHash<QString, QList<QLineSeries *>> trackSeries_; ///< ground track series of each displayed satellite
+
+    QHash<QString, QScatterSeries *> trackMarkers_; ///< current position marker of each displayed satellite
+
+    /**
+     * @brief ground track of a satellite split at the antimeridian, thread safe
+     *
+     * @param sat satellite
+     * @param start session start
+     * @param duration session duration in seconds
+     * @param step sampling step in seconds
+     * @return track segments (lon, lat) [deg]
+     */
+    static QVector<QVector<QPointF>> computeGroundTrack(SatelliteForGUI sat, DateTime start, long duration, int step);
+
+    void addGroundTrack(const QString &name);
+
+    void removeGroundTrack(const QString &name);
+
+    void updateTrackMarkers();
+
 
     std::vector<std::tuple<std::string,std::string,VieVS::Scan>> satellitefile_name_scan;
     std::vector<VieVS::Scan> scheduledScans;
+    std::vector<VieVS::Scan> candidateScans_; ///< scans listed in treeWidget_template
+
+    SatelliteScanValidator adjustValidator_; ///< live validation of the rows of tableWidget_adjust
+
+    /**
+     * @brief loads pass windows and scheduled scans into adjustValidator_ and evaluates all rows of tableWidget_adjust
+     */
+    void resetAdjustValidator();
+
+    /**
+     * @brief updates one row of tableWidget_adjust in adjustValidator_ and marks it
+     *
+     * @param row table row
+     */
+    void updateAdjustRow(int row);
+
+    /**
+     * @brief shows the state of the adjusted scan in label_adjustStatus
+     */
+    void updateAdjustStatus();
+
+    /**
+     * @brief computes the passes and coverage of all satellites which are not cached yet, shows a progress dialog
+     *
+     * @return false if canceled
+     */
+    bool computeAllPasses();
 
     std::vector<SatelliteForGUI> satellites;
     SatelliteMain satelliteScheduler;
@@ -0,0 +1,237 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catalogmodel.h"
+
+void StationCatalog::reserve(int n)
+{
+    for(QVector<double> *v : {&lat, &lon, &diam, &sefdX, &sefdS, &axisOffset, &rate1, &con1, &axis1Low, &axis1Up,
+                              &rate2, &con2, &axis2Low, &axis2Up, &x, &y, &z}){
+        v->reserve(n);
+    }
+    name.reserve(n);
+    id.reserve(n);
+}
+
+void SourceCatalog::reserve(int n)
+{
+    name.reserve(n);
+    ra.reserve(n);
+    de.reserve(n);
+}
+
+
+StationCatalogModel::StationCatalogModel(QObject *parent):
+    QAbstractTableModel(parent), icon_{":/icons/icons/station.png"}
+{
+}
+
+int StationCatalogModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : catalog_.size();
+}
+
+int StationCatalogModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : nColumns;
+}
+
+double StationCatalogModel::value(int row, int column) const
+{
+    switch (column) {
+    case lat: return catalog_.lat[row];
+    case lon: return catalog_.lon[row];
+    case diam: return catalog_.diam[row];
+    case sefdX: return catalog_.sefdX[row];
+    case sefdS: return catalog_.sefdS[row];
+    case axisOffset: return catalog_.axisOffset[row];
+    case rate1: return catalog_.rate1[row];
+    case con1: return catalog_.con1[row];
+    case axis1Low: return catalog_.axis1Low[row];
+    case axis1Up: return catalog_.axis1Up[row];
+    case rate2: return catalog_.rate2[row];
+    case con2: return catalog_.con2[row];
+    case axis2Low: return catalog_.axis2Low[row];
+    case axis2Up: return catalog_.axis2Up[row];
+    case x: return catalog_.x[row];
+    case y: return catalog_.y[row];
+    case z: return catalog_.z[row];
+    default: return 0;
+    }
+}
+
+QVariant StationCatalogModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= catalog_.size()){
+        return QVariant();
+    }
+    int row = index.row();
+    int column = index.column();
+
+    if(role == Qt::DecorationRole && column == name){
+        return icon_;
+    }
+    if(role != Qt::DisplayRole && role != Qt::EditRole){
+        return QVariant();
+    }
+    switch (column) {
+    case name: return catalog_.name[row];
+    case id: return catalog_.id[row];
+    default: return value(row, column);
+    }
+}
+
+QVariant StationCatalogModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if(orientation != Qt::Horizontal || role != Qt::DisplayRole){
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    switch (section) {
+    case name: return tr("name");
+    case id: return tr("Id");
+    case lat: return tr("lat [deg]");
+    case lon: return tr("lon [deg]");
+    case diam: return tr("diam [m]");
+    case sefdX: return tr("SEFD X [Jy]");
+    case sefdS: return tr("SEFD S [Jy]");
+    case axisOffset: return tr("axis offset [m]");
+    case rate1: return tr("slew rate1 [deg/min]");
+    case con1: return tr("constant overhead1 [sec]");
+    case axis1Low: return tr("lower axis limit1 [deg]");
+    case axis1Up: return tr("upper axis limit1 [deg]");
+    case rate2: return tr("slew rate2 [deg/min]");
+    case con2: return tr("constant overhead2 [sec]");
+    case axis2Low: return tr("lower axis limit2 [deg]");
+    case axis2Up: return tr("upper axis limit2 [deg]");
+    case x: return tr("x [m]");
+    case y: return tr("y [m]");
+    case z: return tr("z [m]");
+    default: return QVariant();
+    }
+}
+
+void StationCatalogModel::setCatalog(StationCatalog catalog)
+{
+    beginResetModel();
+    catalog_ = std::move(catalog);
+    rowOfName_.clear();
+    rowOfName_.reserve(catalog_.size());
+    for(int i=0; i<catalog_.size(); ++i){
+        rowOfName_.insert(catalog_.name[i], i);
+    }
+    endResetModel();
+}
+
+void StationCatalogModel::clear()
+{
+    setCatalog(StationCatalog());
+}
+
+QList<QStandardItem *> StationCatalogModel::items(int row) const
+{
+    QList<QStandardItem *> list;
+    list.append(new QStandardItem(icon_, catalog_.name[row]));
+    list.append(new QStandardItem(catalog_.id[row]));
+    for(int i=lat; i<nColumns; ++i){
+        QStandardItem *itm = new QStandardItem();
+        itm->setData(value(row, i), Qt::DisplayRole);
+        list.append(itm);
+    }
+    return list;
+}
+
+
+SourceCatalogModel::SourceCatalogModel(QObject *parent):
+    QAbstractTableModel(parent), icon_{":/icons/icons/source.png"}
+{
+}
+
+int SourceCatalogModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : catalog_.size();
+}
+
+int SourceCatalogModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : nColumns;
+}
+
+QVariant SourceCatalogModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= catalog_.size()){
+        return QVariant();
+    }
+    int row = index.row();
+
+    if(role == Qt::DecorationRole && index.column() == name){
+        return icon_;
+    }
+    if(role != Qt::DisplayRole && role != Qt::EditRole){
+        return QVariant();
+    }
+    switch (index.column()) {
+    case name: return catalog_.name[row];
+    case ra: return catalog_.ra[row];
+    case de: return catalog_.de[row];
+    default: return QVariant();
+    }
+}
+
+QVariant SourceCatalogModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if(orientation != Qt::Horizontal || role != Qt::DisplayRole){
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    switch (section) {
+    case name: return tr("Name");
+    case ra: return tr("RA [deg]");
+    case de: return tr("DC [deg]");
+    default: return QVariant();
+    }
+}
+
+void SourceCatalogModel::setCatalog(SourceCatalog catalog)
+{
+    beginResetModel();
+    catalog_ = std::move(catalog);
+    rowOfName_.clear();
+    rowOfName_.reserve(catalog_.size());
+    for(int i=0; i<catalog_.size(); ++i){
+        rowOfName_.insert(catalog_.name[i], i);
+    }
+    endResetModel();
+}
+
+void SourceCatalogModel::clear()
+{
+    setCatalog(SourceCatalog());
+}
+
+QList<QStandardItem *> SourceCatalogModel::items(int row) const
+{
+    QList<QStandardItem *> list;
+    list.append(new QStandardItem(icon_, catalog_.name[row]));
+    QStandardItem *itmRa = new QStandardItem();
+    itmRa->setData(catalog_.ra[row], Qt::DisplayRole);
+    list.append(itmRa);
+    QStandardItem *itmDe = new QStandardItem();
+    itmDe->setData(catalog_.de[row], Qt::DisplayRole);
+    list.append(itmDe);
+    return list;
+}
@@ -0,0 +1,186 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef CATALOGMODEL_H
+#define CATALOGMODEL_H
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QIcon>
+#include <QStandardItem>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief station catalog stored column wise, one contiguous array per field
+ */
+struct StationCatalog
+{
+    QVector<QString> name;
+    QVector<QString> id;
+    QVector<double> lat;            ///< latitude [deg]
+    QVector<double> lon;            ///< longitude [deg]
+    QVector<double> diam;           ///< dish diameter [m]
+    QVector<double> sefdX;          ///< SEFD X band [Jy]
+    QVector<double> sefdS;          ///< SEFD S band [Jy]
+    QVector<double> axisOffset;     ///< axis offset [m]
+    QVector<double> rate1;          ///< slew rate axis 1 [deg/min]
+    QVector<double> con1;           ///< constant overhead axis 1 [sec]
+    QVector<double> axis1Low;       ///< lower axis limit 1 [deg]
+    QVector<double> axis1Up;        ///< upper axis limit 1 [deg]
+    QVector<double> rate2;          ///< slew rate axis 2 [deg/min]
+    QVector<double> con2;           ///< constant overhead axis 2 [sec]
+    QVector<double> axis2Low;       ///< lower axis limit 2 [deg]
+    QVector<double> axis2Up;        ///< upper axis limit 2 [deg]
+    QVector<double> x;              ///< x coordinate [m]
+    QVector<double> y;              ///< y coordinate [m]
+    QVector<double> z;              ///< z coordinate [m]
+
+    int size() const{
+        return name.size();
+    }
+
+    void reserve(int n);
+};
+
+/**
+ * @brief source catalog stored column wise, one contiguous array per field
+ */
+struct SourceCatalog
+{
+    QVector<QString> name;
+    QVector<double> ra;             ///< right ascension [deg]
+    QVector<double> de;             ///< declination [deg]
+
+    int size() const{
+        return name.size();
+    }
+
+    void reserve(int n);
+};
+
+/**
+ * @brief read only table model over a StationCatalog
+ *
+ * The columns are the same as the ones of the former QStandardItemModel (name, Id, lat, lon, diam, ...). C++ callers
+ * should use catalog() and findName() instead of going through QVariant.
+ */
+class StationCatalogModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    enum Column{
+        name, id, lat, lon, diam, sefdX, sefdS, axisOffset, rate1, con1, axis1Low, axis1Up,
+        rate2, con2, axis2Low, axis2Up, x, y, z, nColumns
+    };
+
+    explicit StationCatalogModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief replaces the whole catalog (model reset)
+     */
+    void setCatalog(StationCatalog catalog);
+
+    void clear();
+
+    const StationCatalog &catalog() const{
+        return catalog_;
+    }
+
+    /**
+     * @brief row of station, -1 if unknown
+     */
+    int findName(const QString &name) const{
+        return rowOfName_.value(name, -1);
+    }
+
+    /**
+     * @brief one item per column of row, used to copy a station into a QStandardItemModel
+     */
+    QList<QStandardItem *> items(int row) const;
+
+private:
+    StationCatalog catalog_;
+    QHash<QString, int> rowOfName_;
+    QIcon icon_;
+
+    double value(int row, int column) const;
+};
+
+/**
+ * @brief read only table model over a SourceCatalog
+ *
+ * Columns: Name, RA [deg], DC [deg]
+ */
+class SourceCatalogModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    enum Column{
+        name, ra, de, nColumns
+    };
+
+    explicit SourceCatalogModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief replaces the whole catalog (model reset)
+     */
+    void setCatalog(SourceCatalog catalog);
+
+    void clear();
+
+    const SourceCatalog &catalog() const{
+        return catalog_;
+    }
+
+    /**
+     * @brief row of source, -1 if unknown
+     */
+    int findName(const QString &name) const{
+        return rowOfName_.value(name, -1);
+    }
+
+    /**
+     * @brief one item per column of row, used to copy a source into a QStandardItemModel
+     */
+    QList<QStandardItem *> items(int row) const;
+
+private:
+    SourceCatalog catalog_;
+    QHash<QString, int> rowOfName_;
+    QIcon icon_;
+};
+
+#endif // CATALOGMODEL_H
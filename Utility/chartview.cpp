@@ -29,10 +29,15 @@
 
 #include "chartview.h"
 #include <QtGui/QMouseEvent>
+#include <limits>
 
 ChartView::ChartView(QWidget *parent) :
     QChartView(parent),
-    m_isTouching(false)
+    m_isTouching(false),
+    minx_(std::numeric_limits<double>::lowest()),
+    maxx_(std::numeric_limits<double>::max()),
+    miny_(std::numeric_limits<double>::lowest()),
+    maxy_(std::numeric_limits<double>::max())
 {
     setRubberBand(QChartView::RectangleRubberBand);
 //    setDragMode(QGraphicsView::NoDrag);
@@ -41,7 +46,11 @@ ChartView::ChartView(QWidget *parent) :
 
 ChartView::ChartView(QChart *chart, QWidget *parent) :
     QChartView(chart, parent),
-    m_isTouching(false)
+    m_isTouching(false),
+    minx_(std::numeric_limits<double>::lowest()),
+    maxx_(std::numeric_limits<double>::max()),
+    miny_(std::numeric_limits<double>::lowest()),
+    maxy_(std::numeric_limits<double>::max())
 {
     setRubberBand(QChartView::RectangleRubberBand);
 //    setDragMode(QGraphicsView::NoDrag);
@@ -89,7 +98,7 @@ void ChartView::mousePressEvent(QMouseEvent *event)
 
 void ChartView::mouseMoveEvent(QMouseEvent *event)
 {
-    if(event->buttons() == Qt::MiddleButton){
+    if(event->buttons() == Qt::MiddleButton && !currentViewRect().isNull()){
         QRectF bounds = currentViewRect();
 
         QPoint evpos = event->pos();
@@ -204,6 +213,11 @@ void ChartView::checkZoom()
 {
     auto ax = chart()->axes();
     QValueAxis *axx = qobject_cast<QValueAxis *>(ax.at(0));
+    QValueAxis *axy = qobject_cast<QValueAxis *>(ax.at(1));
+    if(axx == nullptr || axy == nullptr){
+        // e.g. time axis of elevation plots, nothing to clamp
+        return;
+    }
     double minx = axx->min();
     double maxx = axx->max();
     if(minx<minx_){
@@ -212,7 +226,6 @@ void ChartView::checkZoom()
     if(maxx>maxx_){
         maxx = maxx_;
     }
-    QValueAxis *axy = qobject_cast<QValueAxis *>(ax.at(1));
     double miny = axy->min();
     double maxy = axy->max();
     if(miny<miny_){
@@ -229,9 +242,12 @@ QRectF ChartView::currentViewRect()
 {
     auto ax = chart()->axes();
     QValueAxis *axx = qobject_cast<QValueAxis *>(ax.at(0));
+    QValueAxis *axy = qobject_cast<QValueAxis *>(ax.at(1));
+    if(axx == nullptr || axy == nullptr){
+        return QRectF();
+    }
     double minx = axx->min();
     double maxx = axx->max();
-    QValueAxis *axy = qobject_cast<QValueAxis *>(ax.at(1));
     double miny = axy->min();
     double maxy = axy->max();
     return QRectF(QPointF(minx,maxy),QPointF(maxx,miny));
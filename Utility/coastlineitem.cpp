@@ -0,0 +1,115 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "coastlineitem.h"
+
+#include <QFile>
+#include <QPainter>
+#include <QtNumeric>
+
+CoastlineItem::CoastlineItem(QChart *chart):
+    QGraphicsObject(chart), chart_{chart}
+{
+    setAcceptedMouseButtons(Qt::NoButton);
+    setAcceptHoverEvents(false);
+    setZValue(3.5); // above grid and axes, below all series
+    connect(chart_, SIGNAL(plotAreaChanged(QRectF)), this, SLOT(chartChanged()));
+}
+
+const QPainterPath &CoastlineItem::path()
+{
+    static const QPainterPath coast = [](){
+        QPainterPath p;
+        QFile coastF(":/plotting/coast.txt");
+        if (coastF.open(QIODevice::ReadOnly)){
+            // file format: one "lat,lon" per line, segments are separated by "NaN,NaN"
+            bool newSegment = true;
+            for(const QByteArray &line : coastF.readAll().split('\n')){
+                int comma = line.indexOf(',');
+                if(comma == -1){
+                    continue;
+                }
+                bool okLat = false;
+                bool okLon = false;
+                double lat = line.left(comma).toDouble(&okLat);
+                double lon = line.mid(comma+1).trimmed().toDouble(&okLon);
+                if(!okLat || !okLon || qIsNaN(lat) || qIsNaN(lon)){
+                    newSegment = true;
+                    continue;
+                }
+                if(newSegment){
+                    p.moveTo(lon, lat);
+                    newSegment = false;
+                }else{
+                    p.lineTo(lon, lat);
+                }
+            }
+            coastF.close();
+        }
+        return p;
+    }();
+    return coast;
+}
+
+QRectF CoastlineItem::boundingRect() const
+{
+    return chart_->plotArea();
+}
+
+void CoastlineItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    // axes might be recreated (createDefaultAxes), look them up on every paint
+    QValueAxis *axisX = nullptr;
+    QValueAxis *axisY = nullptr;
+    if(!chart_->axes(Qt::Horizontal).isEmpty()){
+        axisX = qobject_cast<QValueAxis *>(chart_->axes(Qt::Horizontal).first());
+    }
+    if(!chart_->axes(Qt::Vertical).isEmpty()){
+        axisY = qobject_cast<QValueAxis *>(chart_->axes(Qt::Vertical).first());
+    }
+    if(axisX == nullptr || axisY == nullptr || axisX->max() <= axisX->min() || axisY->max() <= axisY->min()){
+        return;
+    }
+    connect(axisX, SIGNAL(rangeChanged(qreal,qreal)), this, SLOT(chartChanged()), Qt::UniqueConnection);
+    connect(axisY, SIGNAL(rangeChanged(qreal,qreal)), this, SLOT(chartChanged()), Qt::UniqueConnection);
+
+    QRectF area = chart_->plotArea();
+    double sx = area.width() / (axisX->max() - axisX->min());
+    double sy = area.height() / (axisY->max() - axisY->min());
+    QTransform t(sx, 0, 0, -sy, area.left() - axisX->min()*sx, area.bottom() + axisY->min()*sy);
+
+    QPen pen(Qt::gray, 2);
+    pen.setCosmetic(true);
+
+    painter->save();
+    painter->setClipRect(area);
+    painter->setPen(pen);
+    painter->setBrush(Qt::NoBrush);
+    painter->setTransform(t, true);
+    painter->drawPath(path());
+    painter->restore();
+}
+
+void CoastlineItem::chartChanged()
+{
+    prepareGeometryChange();
+    update();
+}
@@ -0,0 +1,57 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COASTLINEITEM_H
+#define COASTLINEITEM_H
+
+#include <QGraphicsObject>
+#include <QPainterPath>
+#include <QtCharts/QChart>
+#include <QtCharts/QValueAxis>
+
+QT_CHARTS_USE_NAMESPACE
+
+/**
+ * @brief draws the coastlines into the plot area of a world map chart
+ *
+ * The coastline is parsed once per process into a shared QPainterPath in (lon, lat) coordinates. Each item only maps
+ * this path to the plot area of its chart instead of holding hundreds of line series.
+ */
+class CoastlineItem : public QGraphicsObject
+{
+    Q_OBJECT
+public:
+    explicit CoastlineItem(QChart *chart);
+
+    /**
+     * @brief shared coastline path, x = longitude [deg], y = latitude [deg]
+     */
+    static const QPainterPath &path();
+
+    QRectF boundingRect() const override;
+
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget = nullptr) override;
+
+private slots:
+    void chartChanged();
+
+private:
+    QChart *chart_;
+};
+
+#endif // COASTLINEITEM_H
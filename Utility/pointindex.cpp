@@ -0,0 +1,201 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pointindex.h"
+
+#include <algorithm>
+#include <numeric>
+
+void PointIndex::build(const QVector<QPointF> &points)
+{
+    points_ = points;
+    ids_.resize(points.size());
+    std::iota(ids_.begin(), ids_.end(), 0);
+    build(0, points_.size(), true);
+}
+
+void PointIndex::build(int lo, int hi, bool xAxis)
+{
+    if(hi-lo <= 1){
+        return;
+    }
+    int mid = (lo+hi)/2;
+
+    // sort node ids, then apply the permutation to the points
+    QVector<int> order(hi-lo);
+    std::iota(order.begin(), order.end(), lo);
+    std::nth_element(order.begin(), order.begin()+(mid-lo), order.end(), [&](int a, int b){
+        return xAxis ? points_[a].x() < points_[b].x() : points_[a].y() < points_[b].y();
+    });
+    QVector<QPointF> p(hi-lo);
+    QVector<int> id(hi-lo);
+    for(int i=0; i<order.size(); ++i){
+        p[i] = points_[order[i]];
+        id[i] = ids_[order[i]];
+    }
+    std::copy(p.begin(), p.end(), points_.begin()+lo);
+    std::copy(id.begin(), id.end(), ids_.begin()+lo);
+
+    build(lo, mid, !xAxis);
+    build(mid+1, hi, !xAxis);
+}
+
+int PointIndex::nearest(const QPointF &p, double maxDist2) const
+{
+    int best = -1;
+    double bestDist2 = maxDist2;
+    nearest(0, points_.size(), true, p, best, bestDist2);
+    return best == -1 ? -1 : ids_[best];
+}
+
+void PointIndex::nearest(int lo, int hi, bool xAxis, const QPointF &p, int &best, double &bestDist2) const
+{
+    if(lo >= hi){
+        return;
+    }
+    int mid = (lo+hi)/2;
+    const QPointF &node = points_[mid];
+    double dx = node.x()-p.x();
+    double dy = node.y()-p.y();
+    double d2 = dx*dx+dy*dy;
+    if(d2 < bestDist2 || (d2 == bestDist2 && best != -1 && ids_[mid] < ids_[best])){
+        bestDist2 = d2;
+        best = mid;
+    }
+
+    double delta = xAxis ? p.x()-node.x() : p.y()-node.y();
+    if(delta < 0){
+        nearest(lo, mid, !xAxis, p, best, bestDist2);
+        if(delta*delta <= bestDist2){
+            nearest(mid+1, hi, !xAxis, p, best, bestDist2);
+        }
+    }else{
+        nearest(mid+1, hi, !xAxis, p, best, bestDist2);
+        if(delta*delta <= bestDist2){
+            nearest(lo, mid, !xAxis, p, best, bestDist2);
+        }
+    }
+}
+
+QVector<int> PointIndex::within(const QPointF &p, double dist2) const
+{
+    QVector<int> out;
+    within(0, points_.size(), true, p, dist2, out);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+void PointIndex::within(int lo, int hi, bool xAxis, const QPointF &p, double dist2, QVector<int> &out) const
+{
+    if(lo >= hi){
+        return;
+    }
+    int mid = (lo+hi)/2;
+    const QPointF &node = points_[mid];
+    double dx = node.x()-p.x();
+    double dy = node.y()-p.y();
+    if(dx*dx+dy*dy < dist2){
+        out.append(ids_[mid]);
+    }
+
+    double delta = xAxis ? p.x()-node.x() : p.y()-node.y();
+    if(delta < 0 || delta*delta < dist2){
+        within(lo, mid, !xAxis, p, dist2, out);
+    }
+    if(delta >= 0 || delta*delta < dist2){
+        within(mid+1, hi, !xAxis, p, dist2, out);
+    }
+}
+
+
+SeriesPointIndex::SeriesPointIndex(QObject *parent):
+    QObject(parent)
+{
+}
+
+int SeriesPointIndex::nearest(QXYSeries *series, const QPointF &p)
+{
+    return index(series).nearest(p);
+}
+
+QVector<int> SeriesPointIndex::within(QXYSeries *series, const QPointF &p, double dist2)
+{
+    return index(series).within(p, dist2);
+}
+
+const PointIndex &SeriesPointIndex::index(QXYSeries *series)
+{
+    auto it = entries_.find(series);
+    if(it == entries_.end()){
+        connect(series, SIGNAL(pointAdded(int)), this, SLOT(invalidate()));
+        connect(series, SIGNAL(pointRemoved(int)), this, SLOT(invalidate()));
+        connect(series, SIGNAL(pointReplaced(int)), this, SLOT(invalidate()));
+        connect(series, SIGNAL(pointsReplaced()), this, SLOT(invalidate()));
+        connect(series, SIGNAL(pointsRemoved(int,int)), this, SLOT(invalidate()));
+        connect(series, SIGNAL(destroyed(QObject*)), this, SLOT(seriesDestroyed(QObject*)));
+        it = entries_.insert(series, Entry());
+    }
+    if(it->dirty){
+        it->index.build(QVector<QPointF>::fromList(series->points()));
+        it->dirty = false;
+    }
+    return it->index;
+}
+
+void SeriesPointIndex::invalidate()
+{
+    auto it = entries_.find(sender());
+    if(it != entries_.end()){
+        it->dirty = true;
+    }
+}
+
+void SeriesPointIndex::seriesDestroyed(QObject *obj)
+{
+    entries_.remove(obj);
+}
+
+
+ModelPointIndex::ModelPointIndex(QAbstractItemModel *model, int xColumn, int yColumn, QObject *parent):
+    QObject(parent), model_{model}, xColumn_{xColumn}, yColumn_{yColumn}
+{
+    connect(model_, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)), this, SLOT(invalidate()));
+    connect(model_, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(invalidate()));
+    connect(model_, SIGNAL(rowsRemoved(QModelIndex,int,int)), this, SLOT(invalidate()));
+    connect(model_, SIGNAL(rowsMoved(QModelIndex,int,int,QModelIndex,int)), this, SLOT(invalidate()));
+    connect(model_, SIGNAL(layoutChanged()), this, SLOT(invalidate()));
+    connect(model_, SIGNAL(modelReset()), this, SLOT(invalidate()));
+}
+
+QVector<int> ModelPointIndex::within(const QPointF &p, double dist2)
+{
+    if(dirty_){
+        QVector<QPointF> points(model_->rowCount());
+        for(int i=0; i<points.size(); ++i){
+            points[i] = QPointF(model_->index(i,xColumn_).data().toDouble(), model_->index(i,yColumn_).data().toDouble());
+        }
+        index_.build(points);
+        dirty_ = false;
+    }
+    return index_.within(p, dist2);
+}
+
+void ModelPointIndex::invalidate()
+{
+    dirty_ = true;
+}
@@ -0,0 +1,141 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef POINTINDEX_H
+#define POINTINDEX_H
+
+#include <QObject>
+#include <QVector>
+#include <QPointF>
+#include <QHash>
+#include <QtCharts/QXYSeries>
+#include <QAbstractItemModel>
+#include <limits>
+
+QT_CHARTS_USE_NAMESPACE
+
+/**
+ * @brief static 2d k-d tree for hover hit-testing
+ *
+ * The tree is stored implicitly (median of each range is the node), queries return the index of the point in the
+ * vector that was passed to build().
+ */
+class PointIndex
+{
+public:
+    PointIndex() = default;
+
+    explicit PointIndex(const QVector<QPointF> &points){
+        build(points);
+    }
+
+    void build(const QVector<QPointF> &points);
+
+    /**
+     * @brief closest point
+     *
+     * @param p query point
+     * @param maxDist2 maximum squared distance
+     * @return index of closest point or -1 if no point is within maxDist2
+     */
+    int nearest(const QPointF &p, double maxDist2 = std::numeric_limits<double>::max()) const;
+
+    /**
+     * @brief all points within a squared distance, sorted by index
+     */
+    QVector<int> within(const QPointF &p, double dist2) const;
+
+    int size() const{
+        return points_.size();
+    }
+
+    bool isEmpty() const{
+        return points_.isEmpty();
+    }
+
+private:
+    QVector<QPointF> points_;   ///< points in tree order
+    QVector<int> ids_;          ///< original index of each tree node
+
+    void build(int lo, int hi, bool xAxis);
+
+    void nearest(int lo, int hi, bool xAxis, const QPointF &p, int &best, double &bestDist2) const;
+
+    void within(int lo, int hi, bool xAxis, const QPointF &p, double dist2, QVector<int> &out) const;
+};
+
+/**
+ * @brief one PointIndex per chart series, rebuilt lazily after the points of the series changed
+ */
+class SeriesPointIndex : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SeriesPointIndex(QObject *parent = nullptr);
+
+    /**
+     * @brief index of the point of series closest to p, -1 if the series is empty
+     */
+    int nearest(QXYSeries *series, const QPointF &p);
+
+    /**
+     * @brief all points of series within a squared distance, sorted by index
+     */
+    QVector<int> within(QXYSeries *series, const QPointF &p, double dist2);
+
+private slots:
+    void invalidate();
+
+    void seriesDestroyed(QObject *obj);
+
+private:
+    struct Entry{
+        PointIndex index;
+        bool dirty = true;
+    };
+    QHash<QObject *, Entry> entries_;
+
+    const PointIndex &index(QXYSeries *series);
+};
+
+/**
+ * @brief PointIndex over two numeric columns of an item model, rebuilt lazily after the model changed
+ */
+class ModelPointIndex : public QObject
+{
+    Q_OBJECT
+public:
+    ModelPointIndex(QAbstractItemModel *model, int xColumn, int yColumn, QObject *parent = nullptr);
+
+    /**
+     * @brief all model rows within a squared distance, sorted by row
+     */
+    QVector<int> within(const QPointF &p, double dist2);
+
+private slots:
+    void invalidate();
+
+private:
+    QAbstractItemModel *model_;
+    int xColumn_;
+    int yColumn_;
+    PointIndex index_;
+    bool dirty_ = true;
+};
+
+#endif // POINTINDEX_H
@@ -17,6 +17,7 @@
  */
 
 #include "qtutil.h"
+#include "coastlineitem.h"
 
 
 QList<std::tuple<int, double, double, int>> qtUtil::pointingVectors2Lists(const std::vector<VieVS::PointingVector> &pvs)
@@ -57,35 +58,12 @@ void qtUtil::worldMap(ChartView *worldmap)
 
     worldChart->setAcceptHoverEvents(true);
 
-    QFile coastF(":/plotting/coast.txt");
-    if (coastF.open(QIODevice::ReadOnly)){
-        QTextStream in(&coastF);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    worldChart->addAxis(axisX, Qt::AlignBottom);
+    worldChart->addAxis(axisY, Qt::AlignLeft);
+    new CoastlineItem(worldChart);
 
-        int c = 0;
-        while (!in.atEnd()){
-
-            QLineSeries *coast = new QLineSeries(worldChart);
-            coast->setColor(Qt::gray);
-            coast->setName("coast");
-
-            while(!in.atEnd()){
-                QString line = in.readLine();
-
-                if(line == "NaN,NaN"){
-                    ++c;
-                    worldChart->addSeries(coast);
-                    break;
-                }
-                QStringList split = line.split(",",QString::SplitBehavior::SkipEmptyParts);
-                QString lat = split[0];
-                QString lon = split[1];
-                coast->append(lon.toDouble(),lat.toDouble());
-            }
-        }
-        coastF.close();
-    }
-
-    worldChart->createDefaultAxes();
     worldChart->setAcceptHoverEvents(true);
     worldChart->legend()->hide();
     worldChart->axisX()->setRange(-180,180);
@@ -27,6 +27,11 @@
 #include <QRegularExpression>
 #include <QDirIterator>
 #include <QDateTime>
+#include <QEventLoop>
+#include <QFutureWatcher>
+#include <QProgressDialog>
+#include <QTimer>
+#include <QtConcurrent/QtConcurrent>
 
 #include "../VieSchedpp/Scheduler.h"
 #include "chartview.h"
@@ -63,6 +68,55 @@ namespace qtUtil {
     QVector<std::pair<QString, std::pair<int,int>>> getDownTimes(QDateTime sessionStart, QDateTime sessionEnd, QStringList stations, int buffer);
 
     QVector<std::pair<QString, std::pair<int,int>>> getStationIdleTimes(QStringList stations, QDateTime sessionsStart, QDateTime sessionEnd);
+
+    /**
+     * @brief runs a parallel computation in a worker thread and shows its progress in a modal progress dialog
+     *
+     * The computation only updates the atomic counters of progress (done, total, canceled), the dialog polls them
+     * with a timer in the GUI thread. Cancel sets progress.canceled, check it after the call.
+     *
+     * The dialog is shown immediately, so the parent window can not be used while f runs. The future of f is stored
+     * in running until f is finished, the owner of running has to wait for it before it is destroyed because f
+     * usually references the owner.
+     *
+     * @param label text of the progress dialog
+     * @param progress progress of the computation
+     * @param parent parent of the dialog
+     * @param running future of the computation while it runs
+     * @param f computation
+     * @return result of f
+     */
+    template <typename Progress, typename Function>
+    auto runWithProgress(const QString &label, Progress &progress, QWidget *parent, QFuture<void> &running,
+                         Function f) -> decltype(f()) {
+        QProgressDialog dialog(label, "Cancel", 0, 0, parent);
+        dialog.setWindowModality(Qt::WindowModal);
+        dialog.setMinimumDuration(0);
+        dialog.show();
+        QObject::connect(&dialog, &QProgressDialog::canceled, [&progress](){
+            progress.canceled = true;
+        });
+
+        QTimer timer;
+        QObject::connect(&timer, &QTimer::timeout, [&dialog, &progress](){
+            if(!progress.canceled){
+                dialog.setMaximum(progress.total);
+                dialog.setValue(progress.done);
+            }
+        });
+
+        QEventLoop loop;
+        QFutureWatcher<decltype(f())> watcher;
+        QObject::connect(&watcher, &QFutureWatcherBase::finished, &loop, &QEventLoop::quit);
+        QFuture<decltype(f())> future = QtConcurrent::run(f);
+        running = future;
+        watcher.setFuture(future);
+        timer.start(100);
+        loop.exec();
+        timer.stop();
+        running = QFuture<void>();
+        return watcher.result();
+    }
 }
 
 #endif // QTUTIL_H
@@ -0,0 +1,149 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "seriesdownsampler.h"
+
+#include <QtCharts/QValueAxis>
+#include <QtCharts/QDateTimeAxis>
+#include <algorithm>
+#include <limits>
+
+SeriesDownsampler::SeriesDownsampler(QChart *chart):
+    QObject(chart), chart_{chart}
+{
+    connect(chart_, SIGNAL(plotAreaChanged(QRectF)), this, SLOT(update()));
+    connectAxes();
+}
+
+void SeriesDownsampler::connectAxes()
+{
+    for(QAbstractAxis *axis : chart_->axes(Qt::Horizontal)){
+        if(QValueAxis *a = qobject_cast<QValueAxis *>(axis)){
+            connect(a, SIGNAL(rangeChanged(qreal,qreal)), this, SLOT(update()), Qt::UniqueConnection);
+        }else if(QDateTimeAxis *a = qobject_cast<QDateTimeAxis *>(axis)){
+            connect(a, SIGNAL(rangeChanged(QDateTime,QDateTime)), this, SLOT(update()), Qt::UniqueConnection);
+        }
+    }
+}
+
+void SeriesDownsampler::setData(QLineSeries *series, QVector<QPointF> data)
+{
+    if(!data_.contains(series)){
+        connect(series, SIGNAL(destroyed(QObject*)), this, SLOT(seriesDestroyed(QObject*)));
+        connectAxes();
+    }
+    auto it = data_.insert(series, std::move(data));
+    update(series, it.value());
+}
+
+void SeriesDownsampler::seriesDestroyed(QObject *obj)
+{
+    data_.remove(static_cast<QLineSeries *>(obj));
+}
+
+void SeriesDownsampler::update()
+{
+    for(auto it = data_.constBegin(); it != data_.constEnd(); ++it){
+        update(it.key(), it.value());
+    }
+}
+
+void SeriesDownsampler::update(QLineSeries *series, const QVector<QPointF> &data)
+{
+    double xmin = std::numeric_limits<double>::lowest();
+    double xmax = std::numeric_limits<double>::max();
+
+    QList<QAbstractAxis *> axes = chart_->axes(Qt::Horizontal, series);
+    if(!axes.isEmpty()){
+        if(QValueAxis *a = qobject_cast<QValueAxis *>(axes.at(0))){
+            xmin = a->min();
+            xmax = a->max();
+        }else if(QDateTimeAxis *a = qobject_cast<QDateTimeAxis *>(axes.at(0))){
+            xmin = static_cast<double>(a->min().toMSecsSinceEpoch());
+            xmax = static_cast<double>(a->max().toMSecsSinceEpoch());
+        }
+    }
+    if(xmin == std::numeric_limits<double>::lowest() && !data.isEmpty()){
+        xmin = data.first().x();
+        xmax = data.last().x();
+    }
+
+    int buckets = std::max(1, static_cast<int>(chart_->plotArea().width()));
+    series->replace(minMax(data, xmin, xmax, buckets));
+}
+
+QVector<QPointF> SeriesDownsampler::minMax(const QVector<QPointF> &data, double xmin, double xmax, int buckets)
+{
+    auto first = std::lower_bound(data.begin(), data.end(), xmin, [](const QPointF &p, double x){ return p.x() < x; });
+    auto last = std::upper_bound(data.begin(), data.end(), xmax, [](double x, const QPointF &p){ return x < p.x(); });
+    if(first != data.begin()){
+        --first;
+    }
+    if(last != data.end()){
+        ++last;
+    }
+
+    int n = static_cast<int>(last-first);
+    if(n <= 4*buckets){
+        return QVector<QPointF>(first, last);
+    }
+
+    QVector<QPointF> out;
+    out.reserve(4*buckets+2);
+    double width = (xmax-xmin)/buckets;
+
+    auto it = first;
+    while(it != last){
+        int b = static_cast<int>((it->x()-xmin)/width);
+        auto bucketStart = it;
+        auto imin = it;
+        auto imax = it;
+        while(it != last && static_cast<int>((it->x()-xmin)/width) == b){
+            if(it->y() < imin->y()){
+                imin = it;
+            }
+            if(it->y() > imax->y()){
+                imax = it;
+            }
+            ++it;
+        }
+        auto bucketEnd = it-1;
+
+        // keep order along x
+        out.append(*bucketStart);
+        if(imin < imax){
+            if(imin != bucketStart){
+                out.append(*imin);
+            }
+            if(imax != bucketEnd){
+                out.append(*imax);
+            }
+        }else if(imax < imin){
+            if(imax != bucketStart){
+                out.append(*imax);
+            }
+            if(imin != bucketEnd){
+                out.append(*imin);
+            }
+        }
+        if(bucketEnd != bucketStart){
+            out.append(*bucketEnd);
+        }
+    }
+    return out;
+}
@@ -0,0 +1,72 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SERIESDOWNSAMPLER_H
+#define SERIESDOWNSAMPLER_H
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include <QPointF>
+#include <QtCharts/QChart>
+#include <QtCharts/QLineSeries>
+
+QT_CHARTS_USE_NAMESPACE
+
+/**
+ * @brief keeps full resolution line data outside of the chart and only materializes the visible part
+ *
+ * The visible x-range is split into one bucket per pixel column. For each bucket the first, minimum, maximum and last
+ * point are kept, therefore peaks and gaps survive while the number of points in the series is bounded by four times
+ * the plot width. The series are recomputed whenever the horizontal axis range (zoom, rubber band, pan) or the plot
+ * area size changes.
+ */
+class SeriesDownsampler : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SeriesDownsampler(QChart *chart);
+
+    /**
+     * @brief sets full resolution data of a series (sorted by x)
+     */
+    void setData(QLineSeries *series, QVector<QPointF> data);
+
+    /**
+     * @brief min/max bucket downsampling of sorted data
+     *
+     * one point outside of [xmin, xmax] is kept on each side so that lines leave the plot area correctly
+     */
+    static QVector<QPointF> minMax(const QVector<QPointF> &data, double xmin, double xmax, int buckets);
+
+public slots:
+    void update();
+
+private slots:
+    void seriesDestroyed(QObject *obj);
+
+private:
+    QChart *chart_;
+    QHash<QLineSeries *, QVector<QPointF>> data_;
+
+    void connectAxes();
+
+    void update(QLineSeries *series, const QVector<QPointF> &data);
+};
+
+#endif // SERIESDOWNSAMPLER_H
@@ -0,0 +1,134 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "skycoverageraster.h"
+
+#include <algorithm>
+
+SkyCoverageRaster::SkyCoverageRaster(int nEl, int nAz):
+    nEl_{nEl}, nAz_{nAz}
+{
+}
+
+int SkyCoverageRaster::cell(double az, double el) const
+{
+    double s = std::sin(el);
+    int iel = static_cast<int>(s*nEl_);
+    iel = std::max(0, std::min(nEl_-1, iel));
+
+    double a = std::fmod(az, 2*M_PI);
+    if(a < 0){
+        a += 2*M_PI;
+    }
+    int iaz = static_cast<int>(a/(2*M_PI)*nAz_);
+    iaz = std::max(0, std::min(nAz_-1, iaz));
+
+    return iel*nAz_ + iaz;
+}
+
+void SkyCoverageRaster::compute(const QList<qtUtil::ObsData> &obs)
+{
+    int nCells = nEl_*nAz_;
+    startTimes_ = QVector<QVector<int>>(nCells);
+    endTimes_ = QVector<QVector<int>>(nCells);
+
+    for(const auto &any : obs){
+        int c = cell(any.az, any.el);
+        startTimes_[c].append(any.startTime);
+        endTimes_[c].append(any.endTime);
+    }
+    for(int c=0; c<nCells; ++c){
+        std::sort(startTimes_[c].begin(), startTimes_[c].end());
+        std::sort(endTimes_[c].begin(), endTimes_[c].end());
+    }
+}
+
+QVector<int> SkyCoverageRaster::window(int start, int end) const
+{
+    int nCells = nEl_*nAz_;
+    QVector<int> counts(nCells, 0);
+    if(startTimes_.isEmpty()){
+        return counts;
+    }
+    // overlapping: starts not after the end of the window and ends not before its start
+    for(int c=0; c<nCells; ++c){
+        const QVector<int> &starts = startTimes_[c];
+        const QVector<int> &ends = endTimes_[c];
+        int nStarted = static_cast<int>(std::upper_bound(starts.begin(), starts.end(), end) - starts.begin());
+        int nEnded = static_cast<int>(std::lower_bound(ends.begin(), ends.end(), start) - ends.begin());
+        counts[c] = nStarted-nEnded;
+    }
+    return counts;
+}
+
+QImage SkyCoverageRaster::render(int size, int start, int end) const
+{
+    QImage img(size, size, QImage::Format_ARGB32);
+    img.fill(Qt::transparent);
+    if(size <= 0 || startTimes_.isEmpty()){
+        return img;
+    }
+
+    // pixel -> cell mapping only depends on the image size, cache it across time windows
+    if(pixelCellSize_ != size){
+        pixelCellSize_ = size;
+        pixelCell_.fill(-1, size*size);
+        double r0 = size/2.0;
+        for(int y=0; y<size; ++y){
+            for(int x=0; x<size; ++x){
+                double dx = x+0.5-r0;
+                double dy = y+0.5-r0;
+                double r = std::sqrt(dx*dx+dy*dy);
+                if(r > r0){
+                    continue;
+                }
+                double el = (1-r/r0)*M_PI/2;
+                double az = std::atan2(dx, -dy);
+                pixelCell_[y*size+x] = cell(az, el);
+            }
+        }
+    }
+
+    QVector<int> counts = window(start, end);
+    int max = *std::max_element(counts.begin(), counts.end());
+    if(max == 0){
+        return img;
+    }
+
+    // white -> blue color ramp, precomputed per cell
+    QVector<QRgb> colors(counts.size());
+    for(int c=0; c<counts.size(); ++c){
+        if(counts[c] == 0){
+            colors[c] = qRgba(0,0,0,0);
+        }else{
+            double f = static_cast<double>(counts[c])/max;
+            colors[c] = qRgba(static_cast<int>(255-247*f), static_cast<int>(255-207*f), static_cast<int>(255-148*f), 220);
+        }
+    }
+
+    for(int y=0; y<size; ++y){
+        QRgb *line = reinterpret_cast<QRgb *>(img.scanLine(y));
+        const int *cells = pixelCell_.constData() + y*size;
+        for(int x=0; x<size; ++x){
+            if(cells[x] >= 0){
+                line[x] = colors[cells[x]];
+            }
+        }
+    }
+    return img;
+}
@@ -0,0 +1,82 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SKYCOVERAGERASTER_H
+#define SKYCOVERAGERASTER_H
+
+#include <QVector>
+#include <QImage>
+#include <QList>
+
+#include "Utility/qtutil.h"
+
+/**
+ * @brief sky coverage density of one station on an equal area (az, el) grid
+ *
+ * The elevation bands are equally spaced in sin(el), therefore every band - and, with a constant number of azimuth
+ * cells per band, every cell - covers the same solid angle.
+ * The start and end times of the observations are stored sorted per cell. An observation is counted in a time window
+ * if it overlaps the window (same rule as the scatter plot), thus the count of a cell is the number of observations
+ * starting before the end of the window minus the number of observations ending before its start - two binary
+ * searches per cell.
+ */
+class SkyCoverageRaster
+{
+public:
+    SkyCoverageRaster(int nEl = 9, int nAz = 36);
+
+    /**
+     * @brief fills the grid
+     *
+     * thread safe as long as each thread works on its own object
+     *
+     * @param obs observations of this station (times in seconds since session start)
+     */
+    void compute(const QList<qtUtil::ObsData> &obs);
+
+    /**
+     * @brief number of observations per cell overlapping a time window
+     */
+    QVector<int> window(int start, int end) const;
+
+    /**
+     * @brief renders the density of a time window as a polar image
+     *
+     * cells without observations stay transparent
+     *
+     * @param size width and height of the image [px]
+     */
+    QImage render(int size, int start, int end) const;
+
+    int cell(double az, double el) const;
+
+    bool isEmpty() const{
+        return startTimes_.isEmpty();
+    }
+
+private:
+    int nEl_;
+    int nAz_;
+    QVector<QVector<int>> startTimes_;  ///< sorted start times of the observations per cell
+    QVector<QVector<int>> endTimes_;    ///< sorted end times of the observations per cell
+
+    mutable int pixelCellSize_ = 0;     ///< image size of pixelCell_
+    mutable QVector<int> pixelCell_;    ///< cached cell index per pixel, -1 outside of horizon circle
+};
+
+#endif // SKYCOVERAGERASTER_H
@@ -0,0 +1,360 @@
+ # 
+ #  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ #  Copyright (C) 2018  Matthias Schartner
+ #
+ #  This program is free software: you can redistribute it and/or modify
+ #  it under the terms of the GNU General Public License as published by
+ #  the Free Software Foundation, either version 3 of the License, or
+ #  (at your option) any later version.
+ #
+ #  This program is distributed in the hope that it will be useful,
+ #  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ #  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ #  GNU General Public License for more details.
+ #  
+ #  You should have received a copy of the GNU General Public License
+ #  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ #
+
+#-------------------------------------------------
+#
+# source files of the GUI without main.cpp, shared by VieSchedppGUI.pro and the
+# benchmarks in Benchmark/
+#
+#-------------------------------------------------
+SOURCES += \
+    $$PWD/../VieSchedpp/GlobalOptScheduler.cpp \
+    $$PWD/../VieSchedpp/Input/LogParser.cpp \
+    $$PWD/../VieSchedpp/Input/SkdCatalogReader.cpp \
+    $$PWD/../VieSchedpp/Input/SkdParser.cpp \
+    $$PWD/../VieSchedpp/Input/StpParser.cpp \
+    $$PWD/../VieSchedpp/Misc/AvoidSatellites.cpp \
+    $$PWD/../VieSchedpp/Misc/AstronomicalParameters.cpp \
+    $$PWD/../VieSchedpp/Misc/AstrometricCalibratorBlock.cpp \
+    $$PWD/../VieSchedpp/Misc/Flags.cpp \
+    $$PWD/../VieSchedpp/Misc/HighImpactScanDescriptor.cpp \
+    $$PWD/../VieSchedpp/Misc/CalibratorBlock.cpp \
+    $$PWD/../VieSchedpp/Misc/ParallacticAngleBlock.cpp \
+    $$PWD/../VieSchedpp/Misc/DifferentialParallacticAngleBlock.cpp \
+    $$PWD/../VieSchedpp/Misc/LookupTable.cpp \
+    $$PWD/../VieSchedpp/Misc/MultiScheduling.cpp \
+    $$PWD/../VieSchedpp/Misc/StationEndposition.cpp \
+    $$PWD/../VieSchedpp/Misc/TimeSystem.cpp \
+    $$PWD/../VieSchedpp/Misc/util.cpp \
+    $$PWD/../VieSchedpp/Misc/VieVS_NamedObject.cpp \
+    $$PWD/../VieSchedpp/Misc/VieVS_Object.cpp \
+    $$PWD/../VieSchedpp/Misc/WeightFactors.cpp \
+    $$PWD/../VieSchedpp/ObservingMode/Bbc.cpp \
+    $$PWD/../VieSchedpp/ObservingMode/Freq.cpp \
+    $$PWD/../VieSchedpp/ObservingMode/If.cpp \
+    $$PWD/../VieSchedpp/ObservingMode/Mode.cpp \
+    $$PWD/../VieSchedpp/ObservingMode/ObservingMode.cpp \
+    $$PWD/../VieSchedpp/ObservingMode/Track.cpp \
+    $$PWD/../VieSchedpp/Output/Output.cpp \
+    $$PWD/../VieSchedpp/Output/Skd.cpp \
+    $$PWD/../VieSchedpp/Output/Vex.cpp \
+    $$PWD/../VieSchedpp/Output/Ast.cpp \
+    $$PWD/../VieSchedpp/Output/SNR_table.cpp \
+    $$PWD/../VieSchedpp/Output/OperationNotes.cpp \
+    $$PWD/../VieSchedpp/Output/SourceStatistics.cpp \
+    $$PWD/../VieSchedpp/Scan/Observation.cpp \
+    $$PWD/../VieSchedpp/Scan/PointingVector.cpp \
+    $$PWD/../VieSchedpp/Scan/Scan.cpp \
+    $$PWD/../VieSchedpp/Scan/ScanTimes.cpp \
+    $$PWD/../VieSchedpp/Scan/Subcon.cpp \
+    $$PWD/../VieSchedpp/Source/Flux/AbstractFlux.cpp \
+    $$PWD/../VieSchedpp/Source/Flux/Flux_B.cpp \
+    $$PWD/../VieSchedpp/Source/Flux/Flux_M.cpp \
+    $$PWD/../VieSchedpp/Source/Flux/Flux_constant.cpp \
+    $$PWD/../VieSchedpp/Source/AbstractSource.cpp \
+    $$PWD/../VieSchedpp/Source/Quasar.cpp \
+    $$PWD/../VieSchedpp/Source/Satellite.cpp \
+    $$PWD/../VieSchedpp/Source/SourceList.cpp \
+    $$PWD/../VieSchedpp/Station/Antenna/AbstractAntenna.cpp \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_GGAO.cpp \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_ONSALA_VGOS.cpp \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_AzEl.cpp \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_AzEl_acceleration.cpp \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_HaDc.cpp \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_XYew.cpp \
+    $$PWD/../VieSchedpp/Station/CableWrap/AbstractCableWrap.cpp \
+    $$PWD/../VieSchedpp/Station/CableWrap/CableWrap_AzEl.cpp \
+    $$PWD/../VieSchedpp/Station/CableWrap/CableWrap_HaDc.cpp \
+    $$PWD/../VieSchedpp/Station/CableWrap/CableWrap_XYew.cpp \
+    $$PWD/../VieSchedpp/Station/Equip/AbstractEquipment.cpp \
+    $$PWD/../VieSchedpp/Station/Equip/Equipment_elModel.cpp \
+    $$PWD/../VieSchedpp/Station/Equip/Equipment_constant.cpp \
+    $$PWD/../VieSchedpp/Station/Equip/Equipment_elTable.cpp \
+    $$PWD/../VieSchedpp/Station/HorizonMask/AbstractHorizonMask.cpp \
+    $$PWD/../VieSchedpp/Station/HorizonMask/HorizonMask_line.cpp \
+    $$PWD/../VieSchedpp/Station/HorizonMask/HorizonMask_step.cpp \
+    $$PWD/../VieSchedpp/Station/Baseline.cpp \
+    $$PWD/../VieSchedpp/Station/Network.cpp \
+    $$PWD/../VieSchedpp/Station/Position.cpp \
+    $$PWD/../VieSchedpp/Station/SkyCoverage.cpp \
+    $$PWD/../VieSchedpp/Station/Station.cpp \
+    $$PWD/../VieSchedpp/XML/ParameterGroup.cpp \
+    $$PWD/../VieSchedpp/XML/ParameterSettings.cpp \
+    $$PWD/../VieSchedpp/XML/ParameterSetup.cpp \
+    $$PWD/../VieSchedpp/Scheduler.cpp \
+    $$PWD/../VieSchedpp/VieSchedpp.cpp \
+    $$PWD/../VieSchedpp/Initializer.cpp \
+    $$PWD/../VieSchedpp/Algorithm/FocusCorners.cpp \
+    $$PWD/../VieSchedpp/Simulator/Simulator.cpp \
+    $$PWD/../VieSchedpp/Simulator/Solver.cpp \
+    $$PWD/../VieSchedpp/Simulator/Unknown.cpp \
+    $$PWD/Utility/downloadmanager.cpp \
+    $$PWD/Widgets/calibratorblockwidget.cpp \
+    $$PWD/Widgets/mulitschedulingwidget.cpp \
+    $$PWD/Widgets/priorities.cpp \
+    $$PWD/Widgets/satelliteavoidancewidget.cpp \
+    $$PWD/Widgets/setupwidget.cpp \
+    $$PWD/Widgets/simulatorwidget.cpp \
+    #$$PWD/Widgets/skycoveragewidget.cpp \
+    $$PWD/Widgets/sitewidget.cpp \
+    $$PWD/Widgets/skycovwidget.cpp \
+    $$PWD/Widgets/solverwidget.cpp \
+    $$PWD/mainwindow.cpp \
+    $$PWD/Delegates/comboboxdelegate.cpp \
+    $$PWD/Delegates/doublespinboxdelegate.cpp \
+    $$PWD/Delegates/spinboxdelegate.cpp \
+    $$PWD/Models/model_bbc.cpp \
+    $$PWD/Models/model_freq.cpp \
+    $$PWD/Models/model_if.cpp \
+    $$PWD/Models/model_mode.cpp \
+    $$PWD/Models/model_tracks.cpp \
+    $$PWD/Parameters/baselineparametersdialog.cpp \
+    $$PWD/Parameters/sourceparametersdialog.cpp \
+    $$PWD/Parameters/stationparametersdialog.cpp \
+    $$PWD/secondaryGUIs/addbanddialog.cpp \
+    $$PWD/secondaryGUIs/addgroupdialog.cpp \
+    $$PWD/secondaryGUIs/mastersessionviewer.cpp \
+    $$PWD/secondaryGUIs/multischededitdialogdatetime.cpp \
+    $$PWD/secondaryGUIs/multischededitdialogdouble.cpp \
+    $$PWD/secondaryGUIs/multischededitdialogint.cpp \
+    $$PWD/secondaryGUIs/obsmodedialog.cpp \
+    $$PWD/secondaryGUIs/parsedowntimes.cpp \
+    $$PWD/secondaryGUIs/savetosettingsdialog.cpp \
+    $$PWD/secondaryGUIs/settingsloadwindow.cpp \
+    $$PWD/secondaryGUIs/skedcataloginfo.cpp \
+    $$PWD/secondaryGUIs/textfileviewer.cpp \
+    $$PWD/secondaryGUIs/tleformat.cpp \
+    $$PWD/secondaryGUIs/vieschedpp_analyser.cpp \
+    $$PWD/secondaryGUIs/vieschedpp_comparator.cpp \
+    $$PWD/SatelliteGUI/SatelliteAvoidancePreview.cpp \
+    $$PWD/SatelliteGUI/SatelliteBatchPropagator.cpp \
+    $$PWD/SatelliteGUI/SatelliteCatalog.cpp \
+    $$PWD/SatelliteGUI/SatelliteCoverageIndex.cpp \
+    $$PWD/SatelliteGUI/SatelliteEphemeris.cpp \
+    $$PWD/SatelliteGUI/SatelliteForGUI.cpp \
+    $$PWD/SatelliteGUI/SatelliteMain.cpp \
+    $$PWD/SatelliteGUI/SatelliteObs.cpp \
+    $$PWD/SatelliteGUI/SatelliteOutput.cpp \
+    $$PWD/SatelliteGUI/SatelliteScanAssembler.cpp \
+    $$PWD/SatelliteGUI/SatelliteScanValidator.cpp \
+    $$PWD/SatelliteGUI/satellitescheduling.cpp \
+    $$PWD/SatelliteGUI/setTimes.cpp \
+    $$PWD/Utility/callout.cpp \
+    $$PWD/Utility/chartview.cpp \
+    $$PWD/Utility/multicolumnsortfilterproxymodel.cpp \
+    $$PWD/Utility/mytextbrowser.cpp \
+    $$PWD/Utility/qtutil.cpp \
+    $$PWD/Utility/seriesdownsampler.cpp \
+    $$PWD/Utility/pointindex.cpp \
+    $$PWD/Utility/catalogmodel.cpp \
+    $$PWD/Utility/coastlineitem.cpp \
+    $$PWD/Utility/skycoverageraster.cpp \
+    $$PWD/Utility/statistics.cpp \
+    $$PWD/secondaryGUIs/rendersetup.cpp \
+    $$PWD/mainwindows_save_and_load.cpp
+
+HEADERS += \
+    $$PWD/../VieSchedpp/Input/LogParser.h \
+    $$PWD/../VieSchedpp/Input/SkdCatalogReader.h \
+    $$PWD/../VieSchedpp/Input/SkdParser.h \
+    $$PWD/../VieSchedpp/Input/StpParser.h \
+    $$PWD/../VieSchedpp/Misc/AvoidSatellites.h \
+    $$PWD/../VieSchedpp/Misc/AstronomicalParameters.h \
+    $$PWD/../VieSchedpp/Misc/AstrometricCalibratorBlock.h \
+    $$PWD/../VieSchedpp/Misc/Constants.h \
+    $$PWD/../VieSchedpp/Misc/Flags.h \
+    $$PWD/../VieSchedpp/Misc/HighImpactScanDescriptor.h \
+    $$PWD/../VieSchedpp/Misc/CalibratorBlock.h \
+    $$PWD/../VieSchedpp/Misc/ParallacticAngleBlock.h \
+    $$PWD/../VieSchedpp/Misc/DifferentialParallacticAngleBlock.h \
+    $$PWD/../VieSchedpp/Misc/LookupTable.h \
+    $$PWD/../VieSchedpp/Misc/MultiScheduling.h \
+    $$PWD/../VieSchedpp/Misc/sofa.h \
+    $$PWD/../VieSchedpp/Misc/sofam.h \
+    $$PWD/../VieSchedpp/Misc/StationEndposition.h \
+    $$PWD/../VieSchedpp/Misc/Subnetting.h \
+    $$PWD/../VieSchedpp/Misc/TimeSystem.h \
+    $$PWD/../VieSchedpp/Misc/util.h \
+    $$PWD/../VieSchedpp/Misc/VieVS_NamedObject.h \
+    $$PWD/../VieSchedpp/Misc/VieVS_Object.h \
+    $$PWD/../VieSchedpp/Misc/WeightFactors.h \
+    $$PWD/../VieSchedpp/ObservingMode/Bbc.h \
+    $$PWD/../VieSchedpp/ObservingMode/Freq.h \
+    $$PWD/../VieSchedpp/ObservingMode/If.h \
+    $$PWD/../VieSchedpp/ObservingMode/Mode.h \
+    $$PWD/../VieSchedpp/ObservingMode/ObservingMode.h \
+    $$PWD/../VieSchedpp/ObservingMode/Track.h \
+    $$PWD/../VieSchedpp/Output/Output.h \
+    $$PWD/../VieSchedpp/Output/Skd.h \
+    $$PWD/../VieSchedpp/Output/Vex.h \
+    $$PWD/../VieSchedpp/Output/Ast.h \
+    $$PWD/../VieSchedpp/Output/SNR_table.h \
+    $$PWD/../VieSchedpp/Output/OperationNotes.h \
+    $$PWD/../VieSchedpp/Output/SourceStatistics.h \
+    $$PWD/../VieSchedpp/Scan/Observation.h \
+    $$PWD/../VieSchedpp/Scan/PointingVector.h \
+    $$PWD/../VieSchedpp/Scan/Scan.h \
+    $$PWD/../VieSchedpp/Scan/ScanTimes.h \
+    $$PWD/../VieSchedpp/Scan/Subcon.h \
+    $$PWD/../VieSchedpp/Source/Flux/AbstractFlux.h \
+    $$PWD/../VieSchedpp/Source/Flux/Flux_B.h \
+    $$PWD/../VieSchedpp/Source/Flux/Flux_M.h \
+    $$PWD/../VieSchedpp/Source/Flux/Flux_constant.h \
+    $$PWD/../VieSchedpp/Source/AbstractSource.h \
+    $$PWD/../VieSchedpp/Source/Quasar.h \
+    $$PWD/../VieSchedpp/Source/Satellite.h \
+    $$PWD/../VieSchedpp/Source/SourceList.h \
+    $$PWD/../VieSchedpp/Station/Antenna/AbstractAntenna.h \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_GGAO.h \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_ONSALA_VGOS.h \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_AzEl.h \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_AzEl_acceleration.h \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_HaDc.h \
+    $$PWD/../VieSchedpp/Station/Antenna/Antenna_XYew.h \
+    $$PWD/../VieSchedpp/Station/CableWrap/AbstractCableWrap.h \
+    $$PWD/../VieSchedpp/Station/CableWrap/CableWrap_AzEl.h \
+    $$PWD/../VieSchedpp/Station/CableWrap/CableWrap_HaDc.h \
+    $$PWD/../VieSchedpp/Station/CableWrap/CableWrap_XYew.h \
+    $$PWD/../VieSchedpp/Station/Equip/AbstractEquipment.h \
+    $$PWD/../VieSchedpp/Station/Equip/Equipment_elModel.h \
+    $$PWD/../VieSchedpp/Station/Equip/Equipment_constant.h \
+    $$PWD/../VieSchedpp/Station/Equip/Equipment_elTable.h \
+    $$PWD/../VieSchedpp/Station/HorizonMask/AbstractHorizonMask.h \
+    $$PWD/../VieSchedpp/Station/HorizonMask/HorizonMask_line.h \
+    $$PWD/../VieSchedpp/Station/HorizonMask/HorizonMask_step.h \
+    $$PWD/../VieSchedpp/Station/Baseline.h \
+    $$PWD/../VieSchedpp/Station/Network.h \
+    $$PWD/../VieSchedpp/Station/Position.h \
+    $$PWD/../VieSchedpp/Station/SkyCoverage.h \
+    $$PWD/../VieSchedpp/Station/Station.h \
+    $$PWD/../VieSchedpp/XML/ParameterGroup.h \
+    $$PWD/../VieSchedpp/XML/ParameterSettings.h \
+    $$PWD/../VieSchedpp/XML/ParameterSetup.h \
+    $$PWD/../VieSchedpp/Scheduler.h \
+    $$PWD/../VieSchedpp/VieSchedpp.h \
+    $$PWD/../VieSchedpp/Initializer.h \
+    $$PWD/../VieSchedpp/Algorithm/FocusCorners.h \
+    $$PWD/../VieSchedpp/Simulator/Simulator.h \
+    $$PWD/../VieSchedpp/Simulator/Solver.h \
+    $$PWD/../VieSchedpp/Simulator/Unknown.h \
+    $$PWD/../VieSchedpp/SGP4/CoordGeodetic.h \
+    $$PWD/../VieSchedpp/SGP4/Tle.h \
+    $$PWD/../VieSchedpp/SGP4/TleException.h \
+    $$PWD/../VieSchedpp/SGP4/DateTime.h \
+    $$PWD/../VieSchedpp/SGP4/SGP4.h \
+    $$PWD/../VieSchedpp/SGP4/OrbitalElements.h \
+    $$PWD/../VieSchedpp/SGP4/Observer.h \
+    $$PWD/../VieSchedpp/SGP4/Eci.h \
+    $$PWD/Delegates/comboboxdelegate.h \
+    $$PWD/Delegates/doublespinboxdelegate.h \
+    $$PWD/Delegates/spinboxdelegate.h \
+    $$PWD/Models/model_bbc.h \
+    $$PWD/Models/model_freq.h \
+    $$PWD/Models/model_if.h \
+    $$PWD/Models/model_mode.h \
+    $$PWD/Models/model_tracks.h \
+    $$PWD/Parameters/baselineparametersdialog.h \
+    $$PWD/Parameters/sourceparametersdialog.h \
+    $$PWD/Parameters/stationparametersdialog.h \
+    $$PWD/Utility/downloadmanager.h \
+    $$PWD/Widgets/calibratorblockwidget.h \
+    $$PWD/Widgets/mulitschedulingwidget.h \
+    $$PWD/Widgets/priorities.h \
+    $$PWD/Widgets/satelliteavoidancewidget.h \
+    $$PWD/Widgets/setupwidget.h \
+    $$PWD/Widgets/simulatorwidget.h \
+    #$$PWD/Widgets/skycoveragewidget.h \
+    $$PWD/Widgets/sitewidget.h \
+    $$PWD/Widgets/skycovwidget.h \
+    $$PWD/Widgets/solverwidget.h \
+    $$PWD/secondaryGUIs/addbanddialog.h \
+    $$PWD/secondaryGUIs/addgroupdialog.h \
+    $$PWD/secondaryGUIs/mastersessionviewer.h \
+    $$PWD/secondaryGUIs/multischededitdialogdatetime.h \
+    $$PWD/secondaryGUIs/multischededitdialogdouble.h \
+    $$PWD/secondaryGUIs/multischededitdialogint.h \
+    $$PWD/secondaryGUIs/obsmodedialog.h \
+    $$PWD/secondaryGUIs/parsedowntimes.h \
+    $$PWD/secondaryGUIs/savetosettingsdialog.h \
+    $$PWD/secondaryGUIs/settingsloadwindow.h \
+    $$PWD/secondaryGUIs/skedcataloginfo.h \
+    $$PWD/secondaryGUIs/textfileviewer.h \
+    $$PWD/secondaryGUIs/tleformat.h \
+    $$PWD/secondaryGUIs/vieschedpp_analyser.h \
+    $$PWD/secondaryGUIs/vieschedpp_comparator.h \
+    $$PWD/SatelliteGUI/SatelliteAvoidancePreview.h \
+    $$PWD/SatelliteGUI/SatelliteBatchPropagator.h \
+    $$PWD/SatelliteGUI/SatelliteCatalog.h \
+    $$PWD/SatelliteGUI/SatelliteCoverageIndex.h \
+    $$PWD/SatelliteGUI/SatelliteEphemeris.h \
+    $$PWD/SatelliteGUI/SatelliteForGUI.h \
+    $$PWD/SatelliteGUI/SatelliteMain.h \
+    $$PWD/SatelliteGUI/SatelliteObs.h \
+    $$PWD/SatelliteGUI/SatelliteOutput.h \
+    $$PWD/SatelliteGUI/SatelliteProgress.h \
+    $$PWD/SatelliteGUI/SatelliteScanAssembler.h \
+    $$PWD/SatelliteGUI/SatelliteScanValidator.h \
+    $$PWD/SatelliteGUI/satellitescheduling.h \
+    $$PWD/SatelliteGUI/setTimes.h \
+    $$PWD/Utility/callout.h \
+    $$PWD/Utility/chartview.h \
+    $$PWD/Utility/multicolumnsortfilterproxymodel.h \
+    $$PWD/Utility/mytextbrowser.h \
+    $$PWD/Utility/qtutil.h \
+    $$PWD/Utility/seriesdownsampler.h \
+    $$PWD/Utility/pointindex.h \
+    $$PWD/Utility/catalogmodel.h \
+    $$PWD/Utility/coastlineitem.h \
+    $$PWD/Utility/skycoverageraster.h \
+    $$PWD/mainwindow.h \
+    $$PWD/Utility/statistics.h \
+    $$PWD/secondaryGUIs/rendersetup.h
+
+FORMS += \
+    $$PWD/Widgets/calibratorblockwidget.ui \
+    $$PWD/Widgets/mulitschedulingwidget.ui \
+    $$PWD/Widgets/priorities.ui \
+    $$PWD/Widgets/satelliteavoidancewidget.ui \
+    $$PWD/Widgets/setupwidget.ui \
+    $$PWD/Widgets/simulatorwidget.ui \
+    #$$PWD/Widgets/skycoveragewidget.ui \
+    #$$PWD/Widgets/skycoveragewidget_copy.ui \
+    $$PWD/Widgets/sitewidget.ui \
+    $$PWD/Widgets/skycovwidget.ui \
+    $$PWD/Widgets/solverwidget.ui \
+    $$PWD/mainwindow.ui \
+    $$PWD/Parameters/baselineparametersdialog.ui \
+    $$PWD/Parameters/sourceparametersdialog.ui \
+    $$PWD/Parameters/stationparametersdialog.ui \
+    $$PWD/secondaryGUIs/addbanddialog.ui \
+    $$PWD/secondaryGUIs/addgroupdialog.ui \
+    $$PWD/secondaryGUIs/mastersessionviewer.ui \
+    $$PWD/secondaryGUIs/multischededitdialogdatetime.ui \
+    $$PWD/secondaryGUIs/multischededitdialogdouble.ui \
+    $$PWD/secondaryGUIs/multischededitdialogint.ui \
+    $$PWD/secondaryGUIs/obsmodedialog.ui \
+    $$PWD/secondaryGUIs/parsedowntimes.ui \
+    $$PWD/secondaryGUIs/savetosettingsdialog.ui \
+    $$PWD/secondaryGUIs/settingsloadwindow.ui \
+    $$PWD/secondaryGUIs/skedcataloginfo.ui \
+    $$PWD/secondaryGUIs/textfileviewer.ui \
+    $$PWD/secondaryGUIs/tleformat.ui \
+    $$PWD/secondaryGUIs/vieschedpp_analyser.ui \
+    $$PWD/secondaryGUIs/rendersetup.ui \
+    $$PWD/SatelliteGUI/satellitescheduling.ui \
+    $$PWD/SatelliteGUI/setTimes.ui
@@ -1,9 +1,25 @@
 #include "satelliteavoidancewidget.h"
 #include "ui_satelliteavoidancewidget.h"
 
-SatelliteAvoidanceWidget::SatelliteAvoidanceWidget(QWidget *parent) :
+#include <QMessageBox>
+#include <QtMath>
+#include <algorithm>
+#include "../SatelliteGUI/SatelliteForGUI.h"
+#include "../Utility/qtutil.h"
+
+SatelliteAvoidanceWidget::SatelliteAvoidanceWidget(QStandardItemModel *station_model,
+                                                   QStandardItemModel *source_model,
+                                                   QDateTimeEdit *session_start,
+                                                   QDoubleSpinBox *session_duration,
+                                                   QLineEdit *satellite_path,
+                                                   QWidget *parent) :
     QWidget(parent),
-    ui(new Ui::SatelliteAvoidanceWidget)
+    ui(new Ui::SatelliteAvoidanceWidget),
+    station_model_{station_model},
+    source_model_{source_model},
+    session_start_{session_start},
+    session_duration_{session_duration},
+    satellite_path_{satellite_path}
 {
     ui->setupUi(this);
     save_para = ui->pushButton_save;
@@ -11,6 +27,7 @@ SatelliteAvoidanceWidget::SatelliteAvoidanceWidget(QWidget *parent) :
 
 SatelliteAvoidanceWidget::~SatelliteAvoidanceWidget()
 {
+    computation_.waitForFinished();
     delete ui;
 }
 
@@ -84,3 +101,109 @@ void SatelliteAvoidanceWidget::on_pushButton_save_clicked()
     emit update_settings(path, value, name);
 
 }
+
+void SatelliteAvoidanceWidget::on_pushButton_preview_clicked()
+{
+    std::vector<SatelliteForGUI> satellites;
+    try {
+        satellites = SatelliteForGUI::readSatelliteFile(satellite_path_->text().toStdString());
+    }
+    catch(const char* msg)
+    {
+        QMessageBox::warning(this,"Error loading satellites!",msg);
+        return;
+    }
+    if(satellites.empty()){
+        QMessageBox::warning(this,"No satellites found!","There was no satellite information provided within the selected file!");
+        return;
+    }
+    std::vector<Tle> tles;
+    for(const auto &sat : satellites){
+        tles.emplace_back(sat.getHeader(), sat.getLine1(), sat.getLine2());
+    }
+    preview_.setCatalog(tles);
+
+    std::vector<SatelliteAvoidancePreview::Station> stations;
+    for(int i=0; i<station_model_->rowCount(); ++i){
+        SatelliteAvoidancePreview::Station sta;
+        sta.name = station_model_->index(i,0).data().toString().toStdString();
+        sta.lat = qDegreesToRadians(station_model_->index(i,2).data().toDouble());
+        sta.lon = qDegreesToRadians(station_model_->index(i,3).data().toDouble());
+        sta.x = station_model_->index(i,16).data().toDouble();
+        sta.y = station_model_->index(i,17).data().toDouble();
+        sta.z = station_model_->index(i,18).data().toDouble();
+        stations.push_back(sta);
+    }
+    std::vector<SatelliteAvoidancePreview::Source> sources;
+    for(int i=0; i<source_model_->rowCount(); ++i){
+        SatelliteAvoidancePreview::Source src;
+        src.name = source_model_->index(i,0).data().toString().toStdString();
+        src.ra = qDegreesToRadians(source_model_->index(i,1).data().toDouble());
+        src.de = qDegreesToRadians(source_model_->index(i,2).data().toDouble());
+        sources.push_back(src);
+    }
+    if(stations.empty() || sources.empty()){
+        QMessageBox::warning(this,"Nothing to check!","Please select stations and sources first!");
+        return;
+    }
+
+    SatelliteAvoidancePreview::Parameters para;
+    para.extraMargin = ui->doubleSpinBox_errorMargin->value();
+    para.orbitError = ui->spinBox_orbitError->value();
+    para.orbitErrorPerDay = ui->spinBox_orbitErrorPerDay->value();
+    para.checkFrequency = static_cast<unsigned int>(std::max(1, ui->spinBox_checkFrequency->value()));
+    para.minElevation = ui->doubleSpinBox_minElevation->value();
+
+    QDateTime start = session_start_->dateTime();
+    DateTime startDate = DateTime(start.date().year(), start.date().month(), start.date().day(),
+                                  start.time().hour(), start.time().minute(), start.time().second());
+    unsigned int duration = static_cast<unsigned int>(session_duration_->value()*3600);
+
+    std::size_t bytes = SatelliteAvoidancePreview::maskBytes(stations.size(), sources.size(), duration, para.checkFrequency);
+    if(bytes > SatelliteAvoidancePreview::maxMaskBytes){
+        QMessageBox::warning(this,"Preview too large!",
+                             QString("The preview would need %1 MB (limit %2 MB).\nPlease increase the check frequency or select less sources!")
+                             .arg(bytes/(1024*1024)).arg(SatelliteAvoidancePreview::maxMaskBytes/(1024*1024)));
+        return;
+    }
+
+    SatelliteProgress progress;
+    auto result = qtUtil::runWithProgress("checking satellite avoidance...", progress, this, computation_, [&](){
+        return preview_.compute(stations, sources, startDate, duration, para, &progress);
+    });
+    if(progress.canceled){
+        return;
+    }
+
+    QTreeWidget *t = ui->treeWidget_preview;
+    t->setSortingEnabled(false);
+    t->clear();
+    double totalVisible = 0;
+    double totalLost = 0;
+    for(size_t i=0; i<sources.size(); ++i){
+        double visible = result.visibleMinutes[i];
+        double lost = result.lostMinutes[i];
+        totalVisible += visible;
+        totalLost += lost;
+
+        QTreeWidgetItem *item = new QTreeWidgetItem();
+        item->setText(0, QString::fromStdString(sources[i].name));
+        item->setData(1, Qt::DisplayRole, qRound(visible));
+        item->setData(2, Qt::DisplayRole, qRound(lost));
+        item->setData(3, Qt::DisplayRole, visible > 0 ? qRound(lost/visible*1000)/10.0 : 0.0);
+        for(int j=1; j<4; ++j){
+            item->setTextAlignment(j, Qt::AlignRight);
+        }
+        t->addTopLevelItem(item);
+    }
+    t->setSortingEnabled(true);
+    t->sortByColumn(2, Qt::DescendingOrder);
+    for(int j=0; j<4; ++j){
+        t->resizeColumnToContents(j);
+    }
+
+    ui->label_preview->setText(QString("%1 satellites, %2 of %3 station minutes lost")
+                               .arg(preview_.numberOfSatellites())
+                               .arg(qRound(totalLost))
+                               .arg(qRound(totalVisible)));
+}
@@ -3,7 +3,13 @@
 
 #include <QWidget>
 #include <QPushButton>
+#include <QStandardItemModel>
+#include <QDateTimeEdit>
+#include <QDoubleSpinBox>
+#include <QLineEdit>
+#include <QFuture>
 #include <boost/property_tree/ptree.hpp>
+#include "../SatelliteGUI/SatelliteAvoidancePreview.h"
 
 namespace Ui {
 class SatelliteAvoidanceWidget;
@@ -14,7 +20,12 @@ class SatelliteAvoidanceWidget : public QWidget
     Q_OBJECT
 
 public:
-    explicit SatelliteAvoidanceWidget(QWidget *parent = nullptr);
+    explicit SatelliteAvoidanceWidget(QStandardItemModel *station_model,
+                                      QStandardItemModel *source_model,
+                                      QDateTimeEdit *session_start,
+                                      QDoubleSpinBox *session_duration,
+                                      QLineEdit *satellite_path,
+                                      QWidget *parent = nullptr);
     ~SatelliteAvoidanceWidget();
     QPushButton *save_para;
 
@@ -24,12 +35,23 @@ public:
 private slots:
     void on_pushButton_save_clicked();
 
+    void on_pushButton_preview_clicked();
+
 
 signals:
     void update_settings(QStringList path, QStringList value, QString name);
 
 private:
     Ui::SatelliteAvoidanceWidget *ui;
+    QStandardItemModel *station_model_;
+    QStandardItemModel *source_model_;
+    QDateTimeEdit *session_start_;
+    QDoubleSpinBox *session_duration_;
+    QLineEdit *satellite_path_;
+
+    SatelliteAvoidancePreview preview_; ///< keeps the satellite ephemerides between previews
+
+    QFuture<void> computation_; ///< running preview computation, references preview_
 };
 
 #endif // SATELLITEAVOIDANCEWIDGET_H
@@ -4,8 +4,8 @@
 setupWidget::setupWidget(Type type,
                          boost::property_tree::ptree &settings,
                          QTableWidget *tableWidget_ModesPolicy,
-                         QStandardItemModel *allStationModel,
-                         QStandardItemModel *allSourceModel,
+                         QAbstractItemModel *allStationModel,
+                         QAbstractItemModel *allSourceModel,
                          QStandardItemModel *allSatelliteModel,
                          QStandardItemModel *allSpacecraftModel,
                          QStandardItemModel *selectedStationModel,
@@ -365,12 +365,11 @@ void setupWidget::displaySetupMember(QString name)
         }else{
             t->setHorizontalHeaderItem(0,new QTableWidgetItem(icon_single,QString("%1").arg(name)));
             t->setRowCount(allModel->columnCount());
-            QList<QStandardItem *> litm = allModel->findItems(name);
-            QStandardItem * itm = litm.at(0);
-            int row = itm->row();
+            QModelIndexList litm = allModel->match(allModel->index(0,0), Qt::DisplayRole, name, 1, Qt::MatchExactly);
+            int row = litm.at(0).row();
             for(int i=0; i<allModel->columnCount(); ++i){
                 QString txt = allModel->headerData(i,Qt::Horizontal).toString();
-                QString txt2 = allModel->item(row,i)->text();
+                QString txt2 = allModel->index(row,i).data().toString();
                 t->setVerticalHeaderItem(i,new QTableWidgetItem(txt));
                 t->setItem(i,0,new QTableWidgetItem(txt2));
             }
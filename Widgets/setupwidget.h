@@ -35,8 +35,8 @@ public:
     explicit setupWidget(Type type,
                          boost::property_tree::ptree &settings,
                          QTableWidget *tableWidget_ModesPolicy,
-                         QStandardItemModel *allStationModel,
-                         QStandardItemModel *allSourceModel,
+                         QAbstractItemModel *allStationModel,
+                         QAbstractItemModel *allSourceModel,
                          QStandardItemModel *allSatelliteModel,
                          QStandardItemModel *allSpacecraftModel,
                          QStandardItemModel *selectedStationModel,
@@ -159,7 +159,7 @@ private:
     QIcon icon_group;
     QIcon icon_add_group;
 
-    QStandardItemModel* allModel;
+    QAbstractItemModel* allModel;
     QStandardItemModel* selectedModel;
     QStandardItemModel* allPlusGroupModel;
 
@@ -183,8 +183,8 @@ private:
     boost::property_tree::ptree &settings;
     QTableWidget *tableWidget_ModesPolicy;
 
-    QStandardItemModel *allStationModel;
-    QStandardItemModel *allSourceModel;
+    QAbstractItemModel *allStationModel;
+    QAbstractItemModel *allSourceModel;
     QStandardItemModel *allSatelliteModel;
     QStandardItemModel *allSpacecraftModel;
 
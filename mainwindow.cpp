@@ -88,6 +88,7 @@ MainWindow::MainWindow(QWidget *parent) :
     ui->horizontalLayout->insertWidget(0,il);
 
     worldmap = new ChartView(this);
+    worldmap->setObjectName("worldmap");
     qtUtil::worldMap(worldmap);
     worldMapCallout = new Callout(worldmap->chart());
     worldMapCallout->hide();
@@ -150,11 +151,6 @@ MainWindow::MainWindow(QWidget *parent) :
     vbox_ms->addWidget(ms_widget,1);
     ui->groupBox_multiScheduling->setLayout(vbox_ms);
 
-    satelliteAvoidanceWidget = new SatelliteAvoidanceWidget();
-    ui->verticalLayout_satelliteAvoidance->addWidget(satelliteAvoidanceWidget,0);
-    connect(satelliteAvoidanceWidget, SIGNAL(update_settings(QStringList, QStringList, QString)),
-            this, SLOT(changeDefaultSettings(QStringList, QStringList, QString)));
-
 
     readSettings();
 
@@ -209,26 +205,8 @@ MainWindow::MainWindow(QWidget *parent) :
     ui->statusBar->addPermanentWidget(createSchedule);
 
 
-    allStationModel = new QStandardItemModel(0,19,this);
-    allStationModel->setHeaderData(0, Qt::Horizontal, QObject::tr("name"));
-    allStationModel->setHeaderData(1, Qt::Horizontal, QObject::tr("Id"));
-    allStationModel->setHeaderData(2, Qt::Horizontal, QObject::tr("lat [deg]"));
-    allStationModel->setHeaderData(3, Qt::Horizontal, QObject::tr("lon [deg]"));
-    allStationModel->setHeaderData(4, Qt::Horizontal, QObject::tr("diam [m]"));
-    allStationModel->setHeaderData(5, Qt::Horizontal, QObject::tr("SEFD X [Jy]"));
-    allStationModel->setHeaderData(6, Qt::Horizontal, QObject::tr("SEFD S [Jy]"));
-    allStationModel->setHeaderData(7, Qt::Horizontal, QObject::tr("axis offset [m]"));
-    allStationModel->setHeaderData(8, Qt::Horizontal, QObject::tr("slew rate1 [deg/min]"));
-    allStationModel->setHeaderData(9, Qt::Horizontal, QObject::tr("constant overhead1 [sec]"));
-    allStationModel->setHeaderData(10, Qt::Horizontal, QObject::tr("lower axis limit1 [deg]"));
-    allStationModel->setHeaderData(11, Qt::Horizontal, QObject::tr("upper axis limit1 [deg]"));
-    allStationModel->setHeaderData(12, Qt::Horizontal, QObject::tr("slew rate2 [deg/min]"));
-    allStationModel->setHeaderData(13, Qt::Horizontal, QObject::tr("constant overhead2 [sec]"));
-    allStationModel->setHeaderData(14, Qt::Horizontal, QObject::tr("lower axis limit2 [deg]"));
-    allStationModel->setHeaderData(15, Qt::Horizontal, QObject::tr("upper axis limit2 [deg]"));
-    allStationModel->setHeaderData(16, Qt::Horizontal, QObject::tr("x [m]"));
-    allStationModel->setHeaderData(17, Qt::Horizontal, QObject::tr("y [m]"));
-    allStationModel->setHeaderData(18, Qt::Horizontal, QObject::tr("z [m]"));
+    allStationModel = new StationCatalogModel(this);
+    stationHoverIndex = new ModelPointIndex(allStationModel, StationCatalogModel::lon, StationCatalogModel::lat, this);
 
     selectedStationModel = new QStandardItemModel(0,19,this);
     selectedStationModel->setHeaderData(0, Qt::Horizontal, QObject::tr("name"));
@@ -273,10 +251,8 @@ MainWindow::MainWindow(QWidget *parent) :
 
     // ----------------------
 
-    allSourceModel = new QStandardItemModel(0,3,this);
-    allSourceModel->setHeaderData(0, Qt::Horizontal, QObject::tr("Name"));
-    allSourceModel->setHeaderData(1, Qt::Horizontal, QObject::tr("RA [deg]"));
-    allSourceModel->setHeaderData(2, Qt::Horizontal, QObject::tr("DC [deg]"));
+    allSourceModel = new SourceCatalogModel(this);
+    sourceHoverIndex = new ModelPointIndex(allSourceModel, SourceCatalogModel::ra, SourceCatalogModel::de, this);
 
     selectedSourceModel = new QStandardItemModel(0,3,this);
     selectedSourceModel->setHeaderData(0, Qt::Horizontal, QObject::tr("Name"));
@@ -596,6 +572,20 @@ MainWindow::MainWindow(QWidget *parent) :
     connect(calibratorWidget->newBaselineGroup,SIGNAL(clicked(bool)), this, SLOT(addGroupBaseline()));
 
     connect(ui->doubleSpinBox_sessionDuration, SIGNAL(valueChanged(double)), calibratorWidget, SLOT(update()));
+
+    satelliteAvoidanceWidget = new SatelliteAvoidanceWidget(selectedStationModel,
+                                                            selectedSourceModel,
+                                                            ui->dateTimeEdit_sessionStart,
+                                                            ui->doubleSpinBox_sessionDuration,
+                                                            ui->lineEdit_pathSatellite_avoid);
+    ui->verticalLayout_satelliteAvoidance->addWidget(satelliteAvoidanceWidget,0);
+    // the widget needs the selected station/source models, therefore its settings are applied after readSettings()
+    auto satelliteAvoidance = settings_.get_child_optional("settings.satelliteAvoidance");
+    if(satelliteAvoidance.is_initialized()){
+        satelliteAvoidanceWidget->fromXML(*satelliteAvoidance);
+    }
+    connect(satelliteAvoidanceWidget, SIGNAL(update_settings(QStringList, QStringList, QString)),
+            this, SLOT(changeDefaultSettings(QStringList, QStringList, QString)));
     connect(calibratorWidget, SIGNAL(update_settings(QStringList, QStringList, QString)),
             this, SLOT(changeDefaultSettings(QStringList, QStringList, QString)));
 
@@ -3003,9 +2993,10 @@ void MainWindow::on_pushButton_browseHdpos_clicked()
 
 void MainWindow::on_pushButton_stations_clicked()
 {
-    allStationModel->removeRows(0,allStationModel->rowCount());
+    allStationModel->clear();
 
     selectedStationModel->removeRows(0,selectedStationModel->rowCount());
+    selectedStationIndex.clear();
     selectedBaselineModel->removeRows(0,selectedBaselineModel->rowCount());
 
     allStationPlusGroupModel->removeRows(0,allStationPlusGroupModel->rowCount());
@@ -3078,7 +3069,7 @@ void MainWindow::on_pushButton_stations_clicked()
 
 void MainWindow::on_pushButton_reloadsources_clicked()
 {
-    allSourceModel->removeRows(0,allSourceModel->rowCount());
+    allSourceModel->clear();
 
     selectedSourceModel->removeRows(0,selectedSourceModel->rowCount());
 
@@ -3327,55 +3318,33 @@ void MainWindow::on_pushButton_clicked()
 
 
         createBaselines = false;
-        selectedStationModel->blockSignals(true);
 
         if(stas.size() >= 2){
-            int n = selectedStationModel->rowCount();
-            for(int i=0; i<n; ++i){
-                QModelIndex index = selectedStationModel->index(0,0);
-                on_treeView_allSelectedStations_clicked(index);
+            while(selectedStationModel->rowCount() > 0){
+                on_treeView_allSelectedStations_clicked(selectedStationModel->index(0,0));
             }
 
-            allStationProxyModel->addFilterFixedString("");
+            const StationCatalog &catalog = allStationModel->catalog();
+            QHash<QString, QString> id2name;
+            for(int j=0; j<catalog.size(); ++j){
+                id2name.insert(catalog.id[j].toUpper(), catalog.name[j]);
+            }
+            QStringList names;
             for(int i=0; i<stas.size(); ++i){
                 QString sta = stas.at(i).toUpper();
-                if(i==stas.size()-1){
-                    selectedStationModel->blockSignals(false);
-                }
-                bool found = false;
-                for(int j=0; j<allStationProxyModel->rowCount(); ++j){
-                    QString itsta = allStationProxyModel->index(j,1).data().toString().toUpper();
-                    if(itsta == sta){
-                        tlc2station[sta] = allStationProxyModel->index(j,0).data().toString();
-                        QModelIndex index = allStationProxyModel->index(j,0);
-                        on_treeView_allAvailabeStations_clicked(index);
-                        found = true;
-                        break;
-                    }
-                }
-                if(!found){
+                auto it = id2name.constFind(sta);
+                if(it != id2name.constEnd()){
+                    tlc2station[sta] = it.value();
+                    names.append(it.value());
+                }else{
                     errorText.append(QString("unknown station %1\n").arg(sta));
                 }
             }
+            selectStations(names);
         } else {
             errorText.append("error while reading stations\n");
         }
         createBaselines = true;
-        networkSizeChanged();
-        auto *tmp = ui->tabWidget_simAna->findChild<QWidget *>("Simulation_Widged");
-        SimulatorWidget *sim = qobject_cast<SimulatorWidget *>(tmp);
-        sim->addStations();
-
-        auto *tmp2 = ui->tabWidget_simAna->findChild<QWidget *>("Solver_Widged");
-        SolverWidget *solver = qobject_cast<SolverWidget *>(tmp2);
-        solver->addStations();
-
-        auto *tmp3 = ui->tabWidget_simAna->findChild<QWidget *>("Priorities_Widged");
-        Priorities *priorities = qobject_cast<Priorities *>(tmp3);
-        priorities->addStations();
-
-        createBaselineModel();
-
 
         ui->schedulerLineEdit->setText(sked);
         ui->correlatorLineEdit->setText(corr);
@@ -3643,6 +3612,8 @@ void MainWindow::readStations()
         positionFile.close();
     }
 
+    StationCatalog catalog;
+    catalog.reserve(antennaMap.size());
     QMap<QString, QStringList>::iterator i;
     for (i = antennaMap.begin(); i != antennaMap.end(); ++i){
         try{
@@ -3713,40 +3684,38 @@ void MainWindow::readStations()
                 continue;
             }
 
-            allStationModel->insertRow(0);
-            allStationModel->setData(allStationModel->index(0, 0), antName);
-            allStationModel->item(0,0)->setIcon(QIcon(":/icons/icons/station.png"));
-            allStationModel->setData(allStationModel->index(0, 1), antId);
-            allStationModel->setData(allStationModel->index(0, 2), (double)((int)(qRadiansToDegrees(lat)*100 +0.5))/100.0);
-            allStationModel->setData(allStationModel->index(0, 3), (double)((int)(qRadiansToDegrees(lon)*100 +0.5))/100.0);
-            allStationModel->setData(allStationModel->index(0, 4), (double)((int)(diam*10 +0.5))/10.0);
+            catalog.name.append(antName);
+            catalog.id.append(antId);
+            catalog.lat.append((double)((int)(qRadiansToDegrees(lat)*100 +0.5))/100.0);
+            catalog.lon.append((double)((int)(qRadiansToDegrees(lon)*100 +0.5))/100.0);
+            catalog.diam.append((double)((int)(diam*10 +0.5))/10.0);
 
-            allStationModel->setData(allStationModel->index(0, 5), SEFD_X);
-            allStationModel->setData(allStationModel->index(0, 6), SEFD_S);
+            catalog.sefdX.append(SEFD_X);
+            catalog.sefdS.append(SEFD_S);
 
-            allStationModel->setData(allStationModel->index(0, 7), offset);
+            catalog.axisOffset.append(offset);
 
-            allStationModel->setData(allStationModel->index(0, 8), rate1);
-            allStationModel->setData(allStationModel->index(0, 9), con1);
-            allStationModel->setData(allStationModel->index(0, 10), axis1_low);
-            allStationModel->setData(allStationModel->index(0, 11), axis1_up);
+            catalog.rate1.append(rate1);
+            catalog.con1.append(con1);
+            catalog.axis1Low.append(axis1_low);
+            catalog.axis1Up.append(axis1_up);
 
-            allStationModel->setData(allStationModel->index(0, 12), rate2);
-            allStationModel->setData(allStationModel->index(0, 13), con2);
-            allStationModel->setData(allStationModel->index(0, 14), axis2_low);
-            allStationModel->setData(allStationModel->index(0, 15), axis2_up);
+            catalog.rate2.append(rate2);
+            catalog.con2.append(con2);
+            catalog.axis2Low.append(axis2_low);
+            catalog.axis2Up.append(axis2_up);
 
-
-            allStationModel->setData(allStationModel->index(0, 16), x);
-            allStationModel->setData(allStationModel->index(0, 17), y);
-            allStationModel->setData(allStationModel->index(0, 18), z);
+            catalog.x.append(x);
+            catalog.y.append(y);
+            catalog.z.append(z);
 
         }catch(...){
 
         }
     }
+    allStationModel->setCatalog(std::move(catalog));
 
-    for(int i=0; i<19; ++i){
+    for(int i=0; i<StationCatalogModel::nColumns; ++i){
         ui->treeView_allAvailabeStations->resizeColumnToContents(i);
     }
 
@@ -3772,21 +3741,13 @@ void MainWindow::on_treeView_allSelectedStations_clicked(const QModelIndex &inde
 {
 
     QString name = selectedStationModel->item(index.row())->text();
+    QString id = selectedStationModel->item(index.row(),1)->text();
+    double x = selectedStationModel->index(index.row(),3).data().toDouble();
+    double y = selectedStationModel->index(index.row(),2).data().toDouble();
     selectedStationModel->removeRow(index.row());
+    selectedStationIndex.remove(id);
     clearGroup(true,false,true, name);
 
-    int row;
-    double x;
-    double y;
-    for(int i = 0; i < allStationModel->rowCount(); ++i){
-        if (allStationModel->index(i,0).data().toString() == name){
-            row = i;
-            x = allStationModel->index(row,3).data().toDouble();
-            y = allStationModel->index(row,2).data().toDouble();
-            break;
-        }
-    }
-
     for(int i = 0; i<selectedStations->count(); ++i){
         double xn = selectedStations->at(i).x();
         double yn = selectedStations->at(i).y();
@@ -3805,7 +3766,7 @@ void MainWindow::on_treeView_allSelectedStations_clicked(const QModelIndex &inde
 
 
     if(createBaselines){
-        createBaselineModel();
+        removeStationBaselines(id);
     }
 
     auto *tmp_ms = ui->groupBox_multiScheduling->findChild<QWidget *>("MultiScheduling_Widged");
@@ -3836,20 +3797,21 @@ void MainWindow::on_treeView_allAvailabeStations_clicked(const QModelIndex &inde
 
         selectedStationModel->insertRow(0);
 
-        int nrow = allStationModel->findItems(name).at(0)->row();
-        for(int i=0; i<allStationModel->columnCount(); ++i){
-            if ( i == allStationModel->columnCount() - 1){
+        int nrow = allStationModel->findName(name);
+        QList<QStandardItem *> items = allStationModel->items(nrow);
+        for(int i=0; i<items.size(); ++i){
+            if ( i == items.size() - 1){
                 stationSetupWidget->setBlock(prev_block_flag);
                 priorities->setBlock(prev_block_flag);
                 solver->setBlock(prev_block_flag);
                 simulator->setBlock(prev_block_flag);
             }
-            selectedStationModel->setItem(0, i, allStationModel->item(nrow,i)->clone() );
+            selectedStationModel->setItem(0, i, items.at(i));
         }
+        selectedStationIndex.insert(allStationModel->catalog().id[nrow], selectedStationModel->index(0,1));
 
         selectedStationModel->sort(0);
-        selectedStations->append(allStationProxyModel->index(row,3).data().toDouble(),
-                                 allStationProxyModel->index(row,2).data().toDouble());
+        selectedStations->append(allStationModel->catalog().lon[nrow], allStationModel->catalog().lat[nrow]);
 
         int r = 0;
         for(int i = 0; i<allStationPlusGroupModel->rowCount(); ++i){
@@ -3867,7 +3829,7 @@ void MainWindow::on_treeView_allAvailabeStations_clicked(const QModelIndex &inde
 
         allStationPlusGroupModel->insertRow(r,new QStandardItem(QIcon(":/icons/icons/station.png"),name));
         if(createBaselines){
-            createBaselineModel();
+            addStationBaselines(allStationModel->catalog().id[nrow]);
         }
         priorities->setBlock(prev_block_flag);
         solver->setBlock(prev_block_flag);
@@ -3878,6 +3840,96 @@ void MainWindow::on_treeView_allAvailabeStations_clicked(const QModelIndex &inde
     ui->lineEdit_allStationsFilter->selectAll();
 }
 
+QStringList MainWindow::selectStations(const QStringList &names)
+{
+    QSet<QString> selected;
+    for(int i = 0; i<selectedStationModel->rowCount(); ++i){
+        selected.insert(selectedStationModel->item(i)->text());
+    }
+    QStringList unknown;
+    QStringList newNames;
+    QVector<int> rows;
+    for(const auto &name : names){
+        int row = allStationModel->findName(name);
+        if(row == -1){
+            unknown.append(name);
+        }else if(!selected.contains(name)){
+            selected.insert(name);
+            newNames.append(name);
+            rows.append(row);
+        }
+    }
+    if(rows.isEmpty()){
+        return unknown;
+    }
+
+    auto *tmp3 = ui->tabWidget_simAna->findChild<QWidget *>("Priorities_Widged");
+    Priorities *priorities = qobject_cast<Priorities *>(tmp3);
+    auto *tmp4 = ui->tabWidget_simAna->findChild<QWidget *>("Solver_Widged");
+    SolverWidget *solver = qobject_cast<SolverWidget *>(tmp4);
+    auto *tmp5 = ui->tabWidget_simAna->findChild<QWidget *>("Simulation_Widged");
+    SimulatorWidget *simulator = qobject_cast<SimulatorWidget *>(tmp5);
+
+    // dependent widgets are updated once at the end instead of once per inserted item
+    bool prev_block_flag = priorities->getBlock();
+    stationSetupWidget->setBlock(true);
+    priorities->setBlock(true);
+    solver->setBlock(true);
+    simulator->setBlock(true);
+    skyCoverageWidget->setBlock(true);
+    siteWidget->setBlock(true);
+
+    const StationCatalog &catalog = allStationModel->catalog();
+    int n = rows.size();
+    QList<QPointF> points;
+    selectedStationModel->insertRows(0, n);
+    for(int k = 0; k<n; ++k){
+        int nrow = rows.at(k);
+        QList<QStandardItem *> items = allStationModel->items(nrow);
+        for(int i=0; i<items.size(); ++i){
+            selectedStationModel->setItem(k, i, items.at(i));
+        }
+        selectedStationIndex.insert(catalog.id[nrow], selectedStationModel->index(k,1));
+        points.append(QPointF(catalog.lon[nrow], catalog.lat[nrow]));
+    }
+    selectedStationModel->sort(0);
+    selectedStations->append(points);
+
+    // station entries follow the groups in alphabetical order, merge the new names in one pass
+    newNames.sort();
+    int k = 0;
+    for(int i = 0; i<allStationPlusGroupModel->rowCount() && k<newNames.size(); ++i){
+        QString txt = allStationPlusGroupModel->item(i)->text();
+        if(groupSta->find(txt.toStdString()) != groupSta->end() || txt == "__all__"){
+            continue;
+        }
+        if(txt>newNames.at(k)){
+            allStationPlusGroupModel->insertRow(i,new QStandardItem(QIcon(":/icons/icons/station.png"),newNames.at(k)));
+            ++k;
+        }
+    }
+    for(; k<newNames.size(); ++k){
+        allStationPlusGroupModel->appendRow(new QStandardItem(QIcon(":/icons/icons/station.png"),newNames.at(k)));
+    }
+
+    stationSetupWidget->setBlock(prev_block_flag);
+    priorities->setBlock(prev_block_flag);
+    solver->setBlock(prev_block_flag);
+    simulator->setBlock(prev_block_flag);
+    skyCoverageWidget->setBlock(prev_block_flag);
+    siteWidget->setBlock(prev_block_flag);
+
+    if(!prev_block_flag){
+        priorities->addStations();
+        solver->addStations();
+        simulator->addStations();
+        skyCoverageWidget->addStations();
+        siteWidget->addStations();
+        createBaselineModel();
+    }
+    return unknown;
+}
+
 //void MainWindow::on_lineEdit_allStationsFilter_textChanged(const QString &arg1)
 //{
 //    allStationProxyModel->addFilterFixedString(arg1);
@@ -3885,12 +3937,13 @@ void MainWindow::on_treeView_allAvailabeStations_clicked(const QModelIndex &inde
 
 void MainWindow::on_treeView_allAvailabeStations_entered(const QModelIndex &index)
 {
-    int row = index.row();
-    QString name = allStationProxyModel->index(row,0).data().toString();
-    QString id = allStationProxyModel->index(row,1).data().toString();
+    int row = allStationProxyModel->mapToSource(index).row();
+    const StationCatalog &catalog = allStationModel->catalog();
+    const QString &name = catalog.name[row];
+    const QString &id = catalog.id[row];
 
-    double x = allStationProxyModel->index(row,3).data().toDouble();
-    double y = allStationProxyModel->index(row,2).data().toDouble();
+    double x = catalog.lon[row];
+    double y = catalog.lat[row];
 
     QString text = QString("%1 (%2) \nlat: %3 [deg] \nlon: %4 [deg] ").arg(name).arg(id).arg(y).arg(x);
     worldMapCallout->setText(text);
@@ -3931,19 +3984,16 @@ void MainWindow::on_treeView_allSelectedStations_entered(const QModelIndex &inde
     QString name = selectedStationModel->index(row,0).data().toString();
     QString id = selectedStationModel->index(row,1).data().toString();
 
-    for(int i = 0; i < allStationModel->rowCount(); ++i){
-        QString newName = allStationModel->index(i,0).data().toString();
-        if (newName == name){
-            double x = allStationModel->index(i,3).data().toDouble();;
-            double y = allStationModel->index(i,2).data().toDouble();;
-            QString text = QString("%1 (%2) \nlat: %3 [deg] \nlon: %4 [deg] ").arg(name).arg(id).arg(y).arg(x);
-            worldMapCallout->setText(text);
-            worldMapCallout->setAnchor(QPointF(x,y));
-            worldMapCallout->setZValue(11);
-            worldMapCallout->updateGeometry();
-            worldMapCallout->show();
-            break;
-        }
+    int i = allStationModel->findName(name);
+    if(i != -1){
+        double x = allStationModel->catalog().lon[i];
+        double y = allStationModel->catalog().lat[i];
+        QString text = QString("%1 (%2) \nlat: %3 [deg] \nlon: %4 [deg] ").arg(name).arg(id).arg(y).arg(x);
+        worldMapCallout->setText(text);
+        worldMapCallout->setAnchor(QPointF(x,y));
+        worldMapCallout->setZValue(11);
+        worldMapCallout->updateGeometry();
+        worldMapCallout->show();
     }
 }
 
@@ -3967,10 +4017,9 @@ void MainWindow::plotWorldMap()
     connect(selectedStations,SIGNAL(hovered(QPointF,bool)),this,SLOT(worldmap_hovered(QPointF,bool)));
 
 
-    for(int row = 0; row<allStationModel->rowCount(); ++row){
-        double lat = allStationModel->index(row,2).data().toDouble();
-        double lon = allStationModel->index(row,3).data().toDouble();
-        availableStations->append(lon,lat);
+    const StationCatalog &catalog = allStationModel->catalog();
+    for(int row = 0; row<catalog.size(); ++row){
+        availableStations->append(catalog.lon[row],catalog.lat[row]);
     }
 
     availableStations->attachAxis(worldChart->axisX());
@@ -3986,22 +4035,15 @@ void MainWindow::worldmap_hovered(QPointF point, bool state)
         QString sta;
         int scans;
         int obs;
-        for(int i = 0; i<allStationModel->rowCount();++i){
-            double x = allStationModel->index(i,3).data().toDouble();
-            double y = allStationModel->index(i,2).data().toDouble();
-            QString name = allStationModel->index(i,0).data().toString();
-            QString id = allStationModel->index(i,1).data().toString();
-
-            auto dx = x-point.x();
-            auto dy = y-point.y();
-            if(dx*dx+dy*dy < 1e-3){
-                if(sta.size()==0){
-                    sta.append(QString("%1 (%2)").arg(name).arg(id));
-                }else{
-                    sta.append(",").append(QString("%1 (%2)").arg(name).arg(id));
-                }
-            }
+        for(int i : stationHoverIndex->within(point, 1e-3)){
+            const QString &name = allStationModel->catalog().name[i];
+            const QString &id = allStationModel->catalog().id[i];
 
+            if(sta.size()==0){
+                sta.append(QString("%1 (%2)").arg(name).arg(id));
+            }else{
+                sta.append(",").append(QString("%1 (%2)").arg(name).arg(id));
+            }
         }
 
         QString text = QString("%1 \nlat: %2 [deg] \nlon: %3 [deg] ").arg(sta).arg(point.y()).arg(point.x());
@@ -4099,144 +4141,190 @@ void MainWindow::createBaselineModel()
         allBaselinePlusGroupModel->appendRow(new QStandardItem(QIcon(":/icons/icons/baseline_group.png"),QString::fromStdString(any.first)));
     }
 
+    auto series = worldmap->chart()->series();
+    for(const auto &any : series){
+        worldmap->chart()->removeSeries(any);
+        if(any != availableStations && any != selectedStations){
+            delete(any);
+        }
+    }
+
     int n = selectedStationModel->rowCount();
     for(int i = 0; i<n; ++i){
         for(int j = i+1; j<n; ++j){
-            QString bl = selectedStationModel->index(i,1).data().toString();
-            bl.append("-").append(selectedStationModel->index(j,1).data().toString());
-            allBaselinePlusGroupModel->appendRow(new QStandardItem(QIcon(":/icons/icons/baseline.png"),bl));
-            int row = selectedBaselineModel->rowCount();
+            addBaseline(i,j);
+        }
+    }
+
+    worldmap->chart()->addSeries(availableStations);
+    worldmap->chart()->addSeries(selectedStations);
+
+    worldmap->chart()->createDefaultAxes();
+    worldmap->chart()->axisX()->setRange(-180,180);
+    worldmap->chart()->axisY()->setRange(-90,90);
+}
+
+void MainWindow::addStationBaselines(const QString &id)
+{
+    auto it = selectedStationIndex.constFind(id);
+    if(it == selectedStationIndex.constEnd() || !it->isValid()){
+        return;
+    }
+    int row = it->row();
 
-            selectedBaselineModel->insertRow(row);
-            selectedBaselineModel->setItem(row,new QStandardItem(QIcon(":/icons/icons/baseline.png"),bl));
+    // station series are drawn on top of the baselines
+    worldmap->chart()->removeSeries(availableStations);
+    worldmap->chart()->removeSeries(selectedStations);
+
+    int n = selectedStationModel->rowCount();
+    for(int i = 0; i<n; ++i){
+        if(i < row){
+            addBaseline(i,row);
+        }else if(i > row){
+            addBaseline(row,i);
         }
     }
 
-    auto series = worldmap->chart()->series();
-    QAbstractSeries *tmpSel;
-    QAbstractSeries *tmpAva;
-    int nn = series.count();
-    for(int i=0; i<nn; ++i){
-        QString name = series.at(i)->name();
-        if(name.size() >=5 && name.left(5) == "coast"){
-            continue;
+    addWorldMapSeries(availableStations);
+    addWorldMapSeries(selectedStations);
+}
+
+void MainWindow::removeStationBaselines(const QString &id)
+{
+    auto involves = [&id](const QString &bl){
+        QStringList stas = bl.section('\n',0,0).split("-");
+        return stas.size() == 2 && (stas.at(0) == id || stas.at(1) == id);
+    };
+
+    for(int i = selectedBaselineModel->rowCount()-1; i>=0; --i){
+        if(involves(selectedBaselineModel->item(i,0)->text())){
+            selectedBaselineModel->removeRow(i);
         }
-        if(name == "selectedStations"){
-            tmpSel = series.at(i);
-            worldmap->chart()->removeSeries(series.at(i));
-            continue;
+    }
+
+    for(int i = allBaselinePlusGroupModel->rowCount()-1; i>0; --i){
+        QString txt = allBaselinePlusGroupModel->item(i)->text();
+        if(groupBl->find(txt.toStdString()) == groupBl->end() && involves(txt)){
+            allBaselinePlusGroupModel->removeRow(i);
         }
-        if(name == "availableStations"){
-            tmpAva = series.at(i);
-            worldmap->chart()->removeSeries(series.at(i));
-            continue;
+    }
+
+    for(const auto &any : worldmap->chart()->series()){
+        if(any != availableStations && any != selectedStations && involves(any->name())){
+            worldmap->chart()->removeSeries(any);
+            delete(any);
         }
-        worldmap->chart()->removeSeries(series.at(i));
-        delete(series.at(i));
     }
-    bool checked = ui->checkBox_showBaselines->checkState();
-    for(int i=0; i<selectedBaselineModel->rowCount(); ++i){
-        QString txt = selectedBaselineModel->item(i,0)->text();
-        QStringList stas = txt.split("-");
-        double lat1, lat2, lon1, lon2, x1,y1,z1,x2,y2,z2;
-
-        bool found1 = false;
-        bool found2 = false;
-        for(int j=0; j<selectedStationModel->rowCount(); ++j){
-            auto thisSta = selectedStationModel->item(j,1)->text();
-            if(thisSta == stas.at(0)){
-                lon1 = selectedStationModel->index(j,3).data().toDouble();
-                lat1 = selectedStationModel->index(j,2).data().toDouble();
-                x1 = selectedStationModel->index(j, 16).data().toDouble();
-                y1 = selectedStationModel->index(j, 17).data().toDouble();
-                z1 = selectedStationModel->index(j, 18).data().toDouble();
-
-                found1 = true;
-            }else if(thisSta == stas.at(1)){
-                lon2 = selectedStationModel->index(j,3).data().toDouble();
-                lat2 = selectedStationModel->index(j,2).data().toDouble();
-                x2 = selectedStationModel->index(j, 16).data().toDouble();
-                y2 = selectedStationModel->index(j, 17).data().toDouble();
-                z2 = selectedStationModel->index(j, 18).data().toDouble();
-
-                found2 = true;
-            }
+}
 
-            if(found1 && found2){
-                break;
-            }
+void MainWindow::addBaseline(int row1, int row2)
+{
+    QString txt = selectedStationModel->index(row1,1).data().toString();
+    txt.append("-").append(selectedStationModel->index(row2,1).data().toString());
+
+    allBaselinePlusGroupModel->appendRow(new QStandardItem(QIcon(":/icons/icons/baseline.png"),txt));
+
+    double lon1 = selectedStationModel->index(row1,3).data().toDouble();
+    double lat1 = selectedStationModel->index(row1,2).data().toDouble();
+    double x1 = selectedStationModel->index(row1, 16).data().toDouble();
+    double y1 = selectedStationModel->index(row1, 17).data().toDouble();
+    double z1 = selectedStationModel->index(row1, 18).data().toDouble();
+
+    double lon2 = selectedStationModel->index(row2,3).data().toDouble();
+    double lat2 = selectedStationModel->index(row2,2).data().toDouble();
+    double x2 = selectedStationModel->index(row2, 16).data().toDouble();
+    double y2 = selectedStationModel->index(row2, 17).data().toDouble();
+    double z2 = selectedStationModel->index(row2, 18).data().toDouble();
+
+    double dist = qRound(qSqrt((x2-x1)*(x2-x1)+(y2-y1)*(y2-y1)+(z2-z1)*(z2-z1))/1000);
+
+    // keep the baseline list sorted by name
+    int row = 0;
+    int end = selectedBaselineModel->rowCount();
+    while(row < end){
+        int mid = (row+end)/2;
+        if(selectedBaselineModel->item(mid,0)->text() < txt){
+            row = mid+1;
+        }else{
+            end = mid;
         }
-        double dist = qRound(qSqrt((x2-x1)*(x2-x1)+(y2-y1)*(y2-y1)+(z2-z1)*(z2-z1))/1000);
-//        selectedBaselineModel->setItem(i,1,new QStandardItem());
-        selectedBaselineModel->setData(selectedBaselineModel->index(i, 1), dist);
-
-        if(lon1>lon2){
-            auto tmp1 = lon1;
-            lon1 = lon2;
-            lon2 = tmp1;
-            auto tmp2 = lat1;
-            lat1 = lat2;
-            lat2 = tmp2;
-        }
-
-        if(qAbs(lon2-lon1)<180){
-            QLineSeries *bl = new QLineSeries(worldmap->chart());
-            bl->setPen(QPen(QBrush(Qt::darkGreen),1.5,Qt::DashLine));
-            bl->append(lon1,lat1);
-            bl->append(lon2,lat2);
-            bl->setName(txt.append(QString("\n%1 [km]").arg(dist)));
-            connect(bl,SIGNAL(hovered(QPointF,bool)),this,SLOT(baselineHovered(QPointF,bool)));
-            if(checked){
-                bl->setVisible(true);
-            }else{
-                bl->setVisible(false);
-            }
+    }
+    selectedBaselineModel->insertRow(row);
+    selectedBaselineModel->setItem(row,new QStandardItem(QIcon(":/icons/icons/baseline.png"),txt));
+    selectedBaselineModel->setData(selectedBaselineModel->index(row, 1), dist);
+
+    if(lon1>lon2){
+        auto tmp1 = lon1;
+        lon1 = lon2;
+        lon2 = tmp1;
+        auto tmp2 = lat1;
+        lat1 = lat2;
+        lat2 = tmp2;
+    }
 
-            worldmap->chart()->addSeries(bl);
+    bool checked = ui->checkBox_showBaselines->checkState();
+    QString name = txt.append(QString("\n%1 [km]").arg(dist));
+    if(qAbs(lon2-lon1)<180){
+        QLineSeries *bl = new QLineSeries(worldmap->chart());
+        bl->setPen(QPen(QBrush(Qt::darkGreen),1.5,Qt::DashLine));
+        bl->append(lon1,lat1);
+        bl->append(lon2,lat2);
+        bl->setName(name);
+        connect(bl,SIGNAL(hovered(QPointF,bool)),this,SLOT(baselineHovered(QPointF,bool)));
+        if(checked){
+            bl->setVisible(true);
         }else{
+            bl->setVisible(false);
+        }
 
-            double dx = 180-qAbs(lon1)+180-qAbs(lon2);
-            double dy = lat2-lat1;
-
-            QLineSeries *bl1 = new QLineSeries(worldmap->chart());
-            bl1->setPen(QPen(QBrush(Qt::darkGreen),1.5,Qt::DashLine));
-            bl1->append(lon1,lat1);
-            double fracx = (180-qAbs(lon1))/dx;
-            double fracy = dy*fracx;
-            bl1->append(-180,lat1+fracy);
-            bl1->setName(txt.append(QString("\n%1 [km]").arg(dist)));
-            connect(bl1,SIGNAL(hovered(QPointF,bool)),this,SLOT(baselineHovered(QPointF,bool)));
-            if(checked){
-                bl1->setVisible(true);
-            }else{
-                bl1->setVisible(false);
-            }
+        addWorldMapSeries(bl);
+    }else{
 
-            QLineSeries *bl2 = new QLineSeries(worldmap->chart());
-            bl2->setPen(QPen(QBrush(Qt::darkGreen),1.5,Qt::DashLine));
-            bl2->append(lon2,lat2);
-            bl2->append(180,lat2-(dy-fracy));
-            bl2->setName(txt.append(QString("\n%1 [km]").arg(dist)));
-            connect(bl2,SIGNAL(hovered(QPointF,bool)),this,SLOT(baselineHovered(QPointF,bool)));
-            if(checked){
-                bl2->setVisible(true);
-            }else{
-                bl2->setVisible(false);
-            }
+        double dx = 180-qAbs(lon1)+180-qAbs(lon2);
+        double dy = lat2-lat1;
+
+        QLineSeries *bl1 = new QLineSeries(worldmap->chart());
+        bl1->setPen(QPen(QBrush(Qt::darkGreen),1.5,Qt::DashLine));
+        bl1->append(lon1,lat1);
+        double fracx = (180-qAbs(lon1))/dx;
+        double fracy = dy*fracx;
+        bl1->append(-180,lat1+fracy);
+        bl1->setName(name);
+        connect(bl1,SIGNAL(hovered(QPointF,bool)),this,SLOT(baselineHovered(QPointF,bool)));
+        if(checked){
+            bl1->setVisible(true);
+        }else{
+            bl1->setVisible(false);
+        }
 
-            if(qAbs(lon1)>qAbs(lon2)){
-                worldmap->chart()->addSeries(bl2);
-                worldmap->chart()->addSeries(bl1);
-            }else{
-                worldmap->chart()->addSeries(bl1);
-                worldmap->chart()->addSeries(bl2);
-            }
+        QLineSeries *bl2 = new QLineSeries(worldmap->chart());
+        bl2->setPen(QPen(QBrush(Qt::darkGreen),1.5,Qt::DashLine));
+        bl2->append(lon2,lat2);
+        bl2->append(180,lat2-(dy-fracy));
+        bl2->setName(name);
+        connect(bl2,SIGNAL(hovered(QPointF,bool)),this,SLOT(baselineHovered(QPointF,bool)));
+        if(checked){
+            bl2->setVisible(true);
+        }else{
+            bl2->setVisible(false);
+        }
+
+        if(qAbs(lon1)>qAbs(lon2)){
+            addWorldMapSeries(bl2);
+            addWorldMapSeries(bl1);
+        }else{
+            addWorldMapSeries(bl1);
+            addWorldMapSeries(bl2);
         }
     }
-    worldmap->chart()->addSeries(tmpAva);
-    worldmap->chart()->addSeries(tmpSel);
+}
 
-    worldmap->chart()->createDefaultAxes();
+void MainWindow::addWorldMapSeries(QAbstractSeries *series)
+{
+    worldmap->chart()->addSeries(series);
+    for(auto *axis : worldmap->chart()->axes()){
+        series->attachAxis(axis);
+    }
 }
 
 
@@ -4373,7 +4461,7 @@ void MainWindow::on_pushButton_loadNetwork_clicked()
     int result = dial->exec();
     if(result == QDialog::Accepted){
 
-        for(int i=0; i<selectedStationModel->rowCount(); ++i){
+        while(selectedStationModel->rowCount() > 0){
             QModelIndex idx = selectedStationModel->index(0,0);
             on_treeView_allSelectedStations_clicked(idx);
         }
@@ -4384,19 +4472,12 @@ void MainWindow::on_pushButton_loadNetwork_clicked()
         int idx = dial->selectedIdx();
         QVector<QString> members = networks.at(idx);
 
+        QStringList names;
         for(const auto&any:members){
-            auto list = allStationModel->findItems(any);
-            if(list.size() == 1){
-                for(int i = 0; i<allStationProxyModel->rowCount(); ++i){
-                    QModelIndex idx = allStationProxyModel->index(i,0);
-                    if(idx.data().toString() == any){
-                        ui->treeView_allAvailabeStations->clicked(idx);
-                    }
-                }
-//                selectedStationModel->appendRow(new QStandardItem(QIcon(":icons/icons/station.png"),list.at(0)->text()));
-            }else{
-                warningTxt.append("    unknown station: ").append(any).append("!\n");
-            }
+            names.append(any);
+        }
+        for(const auto&any:selectStations(names)){
+            warningTxt.append("    unknown station: ").append(any).append("!\n");
         }
         if(!warningTxt.isEmpty()){
             QString txt = "The following errors occurred while loading the network:\n";
@@ -4471,9 +4552,6 @@ void MainWindow::on_checkBox_showBaselines_clicked(bool checked)
     auto series = worldmap->chart()->series();
     for(int i=0; i<series.count(); ++i){
         QString name = series.at(i)->name();
-        if(name.size() >=5 && name.left(5) == "coast"){
-            continue;
-        }
         if(name == "selectedStations"){
             continue;
         }
@@ -4496,6 +4574,7 @@ void MainWindow::readSources()
     selectedSourceModel->blockSignals(true);
 
     QString sourcePath = ui->lineEdit_pathSource->text();
+    SourceCatalog catalog;
 
     QFile sourceFile(sourcePath);
     if (sourceFile.open(QIODevice::ReadOnly)){
@@ -4517,11 +4596,9 @@ void MainWindow::readSources()
             double de = ded.toDouble() + dem.toDouble()/60 + des.toDouble()/3600;
 
             sourceSetupWidget->blockSignal(true);
-            allSourceModel->insertRow(allSourceModel->rowCount());
-            allSourceModel->setData(allSourceModel->index(allSourceModel->rowCount()-1,0), sourceName);
-            allSourceModel->item(allSourceModel->rowCount()-1,0)->setIcon(QIcon(":/icons/icons/source.png"));
-            allSourceModel->setData(allSourceModel->index(allSourceModel->rowCount()-1, 1), (double)((int)(ra*100 +0.5))/100.0);
-            allSourceModel->setData(allSourceModel->index(allSourceModel->rowCount()-1, 2), (double)((int)(de*100 +0.5))/100.0);
+            catalog.name.append(sourceName);
+            catalog.ra.append((double)((int)(ra*100 +0.5))/100.0);
+            catalog.de.append((double)((int)(de*100 +0.5))/100.0);
 
             selectedSourceModel->insertRow(selectedSourceModel->rowCount());
             selectedSourceModel->setData(selectedSourceModel->index(selectedSourceModel->rowCount()-1,0), sourceName);
@@ -4572,6 +4649,7 @@ void MainWindow::readSources()
         }
         sourceFile.close();
     }
+    allSourceModel->setCatalog(std::move(catalog));
     selectedSourceModel->blockSignals(false);
     sourceSetupWidget->blockSignal(false);
     sourceSetupWidget->setupComboBox()->setCurrentIndex(0);
@@ -4585,83 +4663,42 @@ void MainWindow::readSources()
 
 void MainWindow::readSatellites()
 {
-    satelliteSetupWidget->blockSignal(true);
     QString pathToTle = ui->lineEdit_pathSatellite->text();
-    if(pathToTle.isEmpty()){
+    if(pathToTle.isEmpty() || !QFile::exists(pathToTle)){
+        satelliteCatalog.reset();
+        return;
+    }
+    try {
+        satelliteCatalog = std::make_shared<const SatelliteCatalog>(pathToTle.toStdString());
+    }
+    catch(const char* msg)
+    {
+        satelliteCatalog.reset();
+        QMessageBox::warning(this,"Error loading satellites!",msg);
         return;
     }
-    QFile sourceFile(pathToTle);
-    if (sourceFile.open(QIODevice::ReadOnly)){
-        QTextStream in(&sourceFile);
-        QString header;
-        QString line1;
-        QString line2;
-        int flag = 0;
-        while (!in.atEnd()){
-            QString line = in.readLine();
-            line = line.simplified();
-            if(line.isEmpty() || line[0] == "*" || line[0] == "!" || line[0] == "&"){
-                continue;
-            }
-            switch ( flag ) {
-                case 0: {
-                    header = line;
-                    ++flag;
-                    break;
-                }
-                case 1: {
-                    line1 = line;
-                    ++flag;
-                    break;
-                }
-                case 2: {
-                    line2 = line;
-                    ++flag;
-                    break;
-                }
-                default: {
-                    break;
-                }
-            }
-            if ( flag == 3 ) {
-                flag = 0;
-                allSatelliteModel->insertRow(allSatelliteModel->rowCount());
-                int c = 0;
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1,c++), header);
-                allSatelliteModel->item(allSatelliteModel->rowCount()-1,0)->setIcon(QIcon(":/icons/icons/satellite.png"));
-
-                QStringList tmp = line1.split(" ");
-                QString number = tmp[1];
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), number);
-                double year = 2000+tmp[3].left(2).toDouble();
-                double doy = tmp[3].mid(2).toDouble();
-                QDateTime epoch(QDate(year,1,1));
-                double sec = doy*86400-86400;
-                epoch = epoch.addSecs(sec);
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), epoch.toString("yyyy.MM.dd HH:mm:ss"));
-
-                QStringList tmp2 = line2.split(" ");
-                double inc = tmp2[2].toDouble();
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), inc);
-
-                double ra = tmp2[3].toDouble();
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), ra);
-
-                double acc = (QString(".")+tmp2[4]).toDouble();
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), acc);
-
-                double perigee = tmp2[5].toDouble();
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), perigee);
-
-                double mano = tmp2[6].toDouble();
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), mano);
-
-                double mmot = tmp2[7].toDouble();
-                allSatelliteModel->setData(allSatelliteModel->index(allSatelliteModel->rowCount()-1, c++), mmot);
-
 
-            }
-        }
+    satelliteSetupWidget->blockSignal(true);
+    for(size_t i=0; i<satelliteCatalog->size(); ++i){
+        const SatelliteCatalog::Entry &entry = satelliteCatalog->getEntry(i);
+        allSatelliteModel->insertRow(allSatelliteModel->rowCount());
+        int row = allSatelliteModel->rowCount()-1;
+        int c = 0;
+        allSatelliteModel->setData(allSatelliteModel->index(row,c++), QString::fromStdString(entry.name));
+        allSatelliteModel->item(row,0)->setIcon(QIcon(":/icons/icons/satellite.png"));
+
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), QString::number(entry.noradId));
+        QDateTime epoch(QDate(entry.epochYear,1,1));
+        double sec = entry.epochDay*86400-86400;
+        epoch = epoch.addSecs(sec);
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), epoch.toString("yyyy.MM.dd HH:mm:ss"));
+
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), entry.inclination);
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), entry.raan);
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), entry.eccentricity);
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), entry.argPerigee);
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), entry.meanAnomaly);
+        allSatelliteModel->setData(allSatelliteModel->index(row, c++), entry.meanMotion);
     }
     satelliteSetupWidget->blockSignal(false);
     highlightSatelliteEpoch();
@@ -4720,6 +4757,8 @@ void MainWindow::readSpacecraft()
 void MainWindow::on_treeView_allSelectedSources_clicked(const QModelIndex &index)
 {
     QString name = selectedSourceModel->item(index.row())->text();
+    double ra = selectedSourceModel->index(index.row(),1).data().toDouble();
+    double dc = selectedSourceModel->index(index.row(),2).data().toDouble();
     if(ui->comboBox_calibratorBlock_calibratorSources->currentText() == name){
         QMessageBox::warning(this,"Calibration block error!","Deleted source was choosen as calibrator source!\nCheck calibrator block!");
         ui->comboBox_calibratorBlock_calibratorSources->setCurrentIndex(0);
@@ -4735,25 +4774,14 @@ void MainWindow::on_treeView_allSelectedSources_clicked(const QModelIndex &index
 
     clearGroup(false,true,false,name);
 
-    int row;
-    double x;
-    double y;
-    for(int i = 0; i < allSourceModel->rowCount(); ++i){
-        if (allSourceModel->index(i,0).data().toString() == name){
-            row = i;
-            double ra = allSourceModel->index(i,1).data().toDouble();
-            double dc = allSourceModel->index(i,2).data().toDouble();
-            ra -=180;
+    ra -=180;
 
-            double lambda = qDegreesToRadians(ra);
-            double phi = qDegreesToRadians(dc);
-            double hn = qSqrt( 1 + qCos(phi)*qCos(lambda/2) );
+    double lambda = qDegreesToRadians(ra);
+    double phi = qDegreesToRadians(dc);
+    double hn = qSqrt( 1 + qCos(phi)*qCos(lambda/2) );
 
-            x = (2 * qSqrt(2) *qCos(phi) *qSin(lambda/2) ) / hn;
-            y = (qSqrt(2) *qSin(phi) ) / hn;
-            break;
-        }
-    }
+    double x = (2 * qSqrt(2) *qCos(phi) *qSin(lambda/2) ) / hn;
+    double y = (qSqrt(2) *qSin(phi) ) / hn;
 
     for(int i = 0; i<selectedSources->count(); ++i){
         double xn = selectedSources->at(i).x();
@@ -4816,15 +4844,16 @@ void MainWindow::on_treeView_allAvailabeSources_clicked(const QModelIndex &index
 
         selectedSourceModel->insertRow(0);
 
-        int nrow = allSourceModel->findItems(name).at(0)->row();
-        for(int i=0; i<allSourceModel->columnCount(); ++i){
-            selectedSourceModel->setItem(0, i, allSourceModel->item(nrow,i)->clone() );
+        int nrow = allSourceModel->findName(name);
+        QList<QStandardItem *> items = allSourceModel->items(nrow);
+        for(int i=0; i<items.size(); ++i){
+            selectedSourceModel->setItem(0, i, items.at(i));
         }
 
         selectedSourceModel->sort(0);
 
-        double ra = allSourceProxyModel->index(row,1).data().toDouble();
-        double dc = allSourceProxyModel->index(row,2).data().toDouble();
+        double ra = allSourceModel->catalog().ra[nrow];
+        double dc = allSourceModel->catalog().de[nrow];
         ra -=180;
 
         double lambda = qDegreesToRadians(ra);
@@ -5005,12 +5034,12 @@ void MainWindow::on_treeView_allAvailabeSpacecrafts_clicked(const QModelIndex &i
 
 void MainWindow::on_treeView_allAvailabeSources_entered(const QModelIndex &index)
 {
-    int row = index.row();
-    QString name = allSourceProxyModel->index(row,0).data().toString();
+    int row = allSourceProxyModel->mapToSource(index).row();
+    const QString &name = allSourceModel->catalog().name[row];
 
-    double ra = allSourceProxyModel->index(row,1).data().toDouble();
+    double ra = allSourceModel->catalog().ra[row];
     ra -=180;
-    double dc = allSourceProxyModel->index(row,2).data().toDouble();
+    double dc = allSourceModel->catalog().de[row];
 
     double lambda = qDegreesToRadians(ra);
     double phi = qDegreesToRadians(dc);
@@ -5033,30 +5062,26 @@ void MainWindow::on_treeView_allSelectedSources_entered(const QModelIndex &index
     int row = index.row();
     QString name = selectedSourceModel->index(row,0).data().toString();
 
-    for(int i = 0; i < allSourceModel->rowCount(); ++i){
-        QString newName = allSourceModel->index(i,0).data().toString();
-
-        if (newName == name){
-            double ra = allSourceModel->index(i,1).data().toDouble();
-            ra -=180;
-            double dc = allSourceModel->index(i,2).data().toDouble();
+    int i = allSourceModel->findName(name);
+    if (i != -1){
+        double ra = allSourceModel->catalog().ra[i];
+        ra -=180;
+        double dc = allSourceModel->catalog().de[i];
 
-            double lambda = qDegreesToRadians(ra);
-            double phi = qDegreesToRadians(dc);
-            double hn = qSqrt( 1 + qCos(phi)*qCos(lambda/2) );
+        double lambda = qDegreesToRadians(ra);
+        double phi = qDegreesToRadians(dc);
+        double hn = qSqrt( 1 + qCos(phi)*qCos(lambda/2) );
 
-            double x = (2 * qSqrt(2) *qCos(phi) *qSin(lambda/2) ) / hn;
-            double y = (qSqrt(2) *qSin(phi) ) / hn;
+        double x = (2 * qSqrt(2) *qCos(phi) *qSin(lambda/2) ) / hn;
+        double y = (qSqrt(2) *qSin(phi) ) / hn;
 
 
-            QString text = QString("%1 \nra: %2 [deg] \ndec: %3 [deg] ").arg(name).arg(ra+180).arg(dc);
-            skyMapCallout->setText(text);
-            skyMapCallout->setAnchor(QPointF(x,y));
-            skyMapCallout->setZValue(11);
-            skyMapCallout->updateGeometry();
-            skyMapCallout->show();
-            break;
-        }
+        QString text = QString("%1 \nra: %2 [deg] \ndec: %3 [deg] ").arg(name).arg(ra+180).arg(dc);
+        skyMapCallout->setText(text);
+        skyMapCallout->setAnchor(QPointF(x,y));
+        skyMapCallout->setZValue(11);
+        skyMapCallout->updateGeometry();
+        skyMapCallout->show();
     }
 }
 
@@ -5080,11 +5105,12 @@ void MainWindow::plotSkyMap(){
     connect(availableSources,SIGNAL(hovered(QPointF,bool)),this,SLOT(skymap_hovered(QPointF,bool)));
     connect(selectedSources,SIGNAL(hovered(QPointF,bool)),this,SLOT(skymap_hovered(QPointF,bool)));
 
-    for(int i = 0; i< allSourceModel->rowCount(); ++i){
-        double ra = allSourceModel->item(i,1)->text().toDouble();
+    const SourceCatalog &catalog = allSourceModel->catalog();
+    for(int i = 0; i< catalog.size(); ++i){
+        double ra = catalog.ra[i];
         double lambda = qDegreesToRadians(ra);
 
-        double dc = allSourceModel->item(i,2)->text().toDouble();
+        double dc = catalog.de[i];
         double phi = qDegreesToRadians(dc);
 
         auto xy = qtUtil::radec2xy(lambda, phi);
@@ -5114,18 +5140,11 @@ void MainWindow::skymap_hovered(QPointF point, bool state){
         double pde = qRadiansToDegrees(qAsin(z*py));
 
         QString src;
-        for(int i = 0; i<allSourceModel->rowCount();++i){
-            double ra = allSourceModel->index(i,1).data().toDouble();
-            double de = allSourceModel->index(i,2).data().toDouble();
-
-            auto dra = ra-pra;
-            auto dde = de-pde;
-            if(dra*dra+dde*dde < 10){
-                if(src.size()==0){
-                    src.append(allSourceModel->index(i,0).data().toString());
-                }else{
-                    src.append(","+allSourceModel->index(i,0).data().toString());
-                }
+        for(int i : sourceHoverIndex->within(QPointF(pra, pde), 10)){
+            if(src.size()==0){
+                src.append(allSourceModel->catalog().name[i]);
+            }else{
+                src.append(","+allSourceModel->catalog().name[i]);
             }
         }
 
@@ -5434,8 +5453,7 @@ void MainWindow::on_pushButton_loadSourceList_clicked()
 
         on_pushButton_15_clicked();
         for(const auto&any:members){
-            auto list = allSourceModel->findItems(any);
-            if(list.size() == 1){
+            if(allSourceModel->findName(any) != -1){
                 for(int i = 0; i<allSourceProxyModel->rowCount(); ++i){
                     QModelIndex idx = allSourceProxyModel->index(i,0);
                     if(idx.data().toString() == any){
@@ -6655,7 +6673,6 @@ void MainWindow::on_pushButton_3_clicked()
     QString pathEquip = ui->lineEdit_pathEquip->text();
     QString pathPosition = ui->lineEdit_pathPosition->text();
     QString pathMask = ui->lineEdit_pathMask->text();
-    QString pathSat = ui->lineEdit_pathSatellite->text();
 
     QDateTime startTime = ui->dateTimeEdit_sessionStart->dateTime();
     double dur = ui->doubleSpinBox_sessionDuration->value();
@@ -6670,7 +6687,7 @@ void MainWindow::on_pushButton_3_clicked()
     if (stations.isEmpty()){
         QMessageBox::information(this,"select stations first","Please select your station network before your start with satellite observations");
     }else{
-        SatelliteScheduling *sat = new SatelliteScheduling(pathAntenna, pathEquip, pathPosition, pathMask, pathSat,
+        SatelliteScheduling *sat = new SatelliteScheduling(pathAntenna, pathEquip, pathPosition, pathMask, satelliteCatalog,
                                                            selectedSatelliteModel, allSatelliteModel, allSatellitePlusGroupModel, groupSat,
                                                            startTime, endTime, stations, &settings_, this);
         sat->show();
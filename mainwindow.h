@@ -74,6 +74,8 @@
 #include "secondaryGUIs/vieschedpp_analyser.h"
 #include "../VieSchedpp/Input/SkdParser.h"
 #include "Utility/qtutil.h"
+#include "Utility/pointindex.h"
+#include "Utility/catalogmodel.h"
 #include "secondaryGUIs/skedcataloginfo.h"
 #include "Utility/multicolumnsortfilterproxymodel.h"
 #include "secondaryGUIs/obsmodedialog.h"
@@ -107,6 +109,8 @@ public:
     explicit MainWindow(QWidget *parent = 0);
     ~MainWindow();
 
+    QStringList selectStations(const QStringList &names);
+
 private slots:    
     void closeEvent(QCloseEvent *event);
 
@@ -558,9 +562,10 @@ private:
 
     VieVS::ParameterSettings para;
 
-    QStandardItemModel *allStationModel;
-    QStandardItemModel *allSourceModel;
+    StationCatalogModel *allStationModel;
+    SourceCatalogModel *allSourceModel;
     QStandardItemModel *allSatelliteModel;
+    std::shared_ptr<const SatelliteCatalog> satelliteCatalog; ///< TLE catalog of allSatelliteModel, shared with SatelliteScheduling
     QStandardItemModel *allSpacecraftModel;
     MultiColumnSortFilterProxyModel *allStationProxyModel;
     MultiColumnSortFilterProxyModel *allSourceProxyModel;
@@ -572,6 +577,7 @@ private:
     QStandardItemModel *selectedBaselineModel;
     QStandardItemModel *selectedSatelliteModel;
     QStandardItemModel *selectedSpacecraftModel;
+    QHash<QString, QPersistentModelIndex> selectedStationIndex; ///< station id to row of selectedStationModel
     bool createBaselines;
 
     QStandardItemModel *allSourcePlusGroupModel_combined;
@@ -596,6 +602,9 @@ private:
     Callout *worldMapCallout;
     Callout *skyMapCallout;
 
+    ModelPointIndex *stationHoverIndex; ///< (lon, lat) of allStationModel
+    ModelPointIndex *sourceHoverIndex;  ///< (ra, de) of allSourceModel
+
     QSignalMapper *deleteModeMapper;
 
     std::map<std::string, std::vector<std::string>> *groupSta = new std::map<std::string, std::vector<std::string>>();
@@ -641,6 +650,14 @@ private:
 
     void plotSkyMap();
 
+    void addStationBaselines(const QString &id);
+
+    void removeStationBaselines(const QString &id);
+
+    void addBaseline(int row1, int row2);
+
+    void addWorldMapSeries(QAbstractSeries *series);
+
     void defaultParameters();
 
     void displayStationSetupMember(QString name);
@@ -127,7 +127,7 @@ QString MainWindow::writeXML()
     if(allSrc-selSrc < allSrc/2){
         useSourcesFromParameter_otherwiseIgnore = false;
         for(int i=0; i<allSourceModel->rowCount(); ++i){
-            std::string thisSrc = allSourceModel->item(i)->text().toStdString();
+            std::string thisSrc = allSourceModel->catalog().name[i].toStdString();
             if(std::find(srcNames.begin(),srcNames.end(),thisSrc) == srcNames.end() ){
                 ignoreSrcNames.push_back(thisSrc);
             }
@@ -815,18 +815,12 @@ void MainWindow::loadXML(QString path)
                 sel_stations.push_back(item);
                 ++it;
             }
+            QStringList names;
             for(const auto &station : sel_stations){
-                bool found = false;
-                for(int i=0; i<allStationProxyModel->rowCount(); ++i){
-                    if(allStationProxyModel->index(i,0).data().toString() == QString::fromStdString(station)){
-                        on_treeView_allAvailabeStations_clicked(allStationProxyModel->index(i,0));
-                        found = true;
-                        break;
-                    }
-                }
-                if(!found){
-                    warning.append("Station "+QString::fromStdString(station)+" not found!");
-                }
+                names.append(QString::fromStdString(station));
+            }
+            for(const auto &name : selectStations(names)){
+                warning.append("Station "+name+" not found!");
             }
         }
 
@@ -2132,11 +2126,6 @@ void MainWindow::readSettings()
     auto *tmp_ms = ui->groupBox_multiScheduling->findChild<QWidget *>("MultiScheduling_Widged");
     MulitSchedulingWidget *ms = qobject_cast<MulitSchedulingWidget *>(tmp_ms);
     ms->setMultiprocessing(threads, nThreadsManual, jobScheduler, chunkSize);
-
-    auto satelliteAvoidance = settings_.get_child_optional("settings.satelliteAvoidance");
-    if ( satelliteAvoidance.is_initialized() ){
-        satelliteAvoidanceWidget->fromXML(*satelliteAvoidance);
-    }
 }
 
 void MainWindow::createDefaultParameterSettings()
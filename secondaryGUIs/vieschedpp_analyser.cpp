@@ -43,6 +43,8 @@ VieSchedpp_Analyser::VieSchedpp_Analyser(VieVS::Scheduler schedule, std::map<std
         freqs_[band] = f;
     }
 
+    hoverIndex_ = new SeriesPointIndex(this);
+
     srcModel = new QStandardItemModel(0,6,this);
     staModel = new QStandardItemModel(0,6,this);
     blModel = new QStandardItemModel(0,4,this);
@@ -85,6 +87,15 @@ VieSchedpp_Analyser::VieSchedpp_Analyser(VieVS::Scheduler schedule, std::map<std
     QHeaderView *hv = ui->tableWidget_general->verticalHeader();
     hv->setSectionResizeMode(QHeaderView::ResizeToContents);
 
+    // dense sessions (e.g. 24h VGOS) are unreadable as scatter plot -> start in density mode
+    int maxScans = 0;
+    for(int i=0; i<staModel->rowCount(); ++i){
+        maxScans = std::max(maxScans, staModel->index(i,2).data().toInt());
+    }
+    if(maxScans > 500){
+        ui->checkBox_skyCoverageRaster->setChecked(true);
+    }
+
 }
 
 VieSchedpp_Analyser::~VieSchedpp_Analyser()
@@ -496,6 +507,7 @@ void VieSchedpp_Analyser::setSkyCoverageLayout(int rows, int columns)
 
             c1->setCurrentIndex(counter);
             connect(c1,SIGNAL(currentIndexChanged(QString)), this, SLOT(updateSkyCoverage(QString)));
+            connect(chart,SIGNAL(plotAreaChanged(QRectF)), this, SLOT(updateSkyCoverageRaster()));
 
             groupBox->setLayout(layout);
 
@@ -1166,39 +1178,44 @@ void VieSchedpp_Analyser::updateSkyCoverageTimes(int idx)
         }
     }
 
-    ccw->clear();
-    cw->clear();
-    n->clear();
     selected->clear();
 
-    int start = ui->horizontalSlider_start->value();
-    int end = ui->horizontalSlider_end->value();
+    // the scatter series are hidden in raster mode, they are rebuilt when it is switched off
+    if(!ui->checkBox_skyCoverageRaster->isChecked()){
+        ccw->clear();
+        cw->clear();
+        n->clear();
 
-    for(int i=0; i<data->count(); ++i){
-        bool flag1 = data->getStartTime(i) >= start && data->getStartTime(i) <= end;
-        bool flag2 = data->getEndTime(i) >= start && data->getEndTime(i) <= end;
-        bool flag3 = data->getStartTime(i) <= start && data->getEndTime(i) >= end;
-        bool flag = flag1 || flag2 || flag3;
+        int start = ui->horizontalSlider_start->value();
+        int end = ui->horizontalSlider_end->value();
 
-        if(flag){
-            switch(data->getCableWrapFlag(i)){
-                case VieVS::AbstractCableWrap::CableWrapFlag::n:{
-                    n->append(data->at(i).x(), data->at(i).y(), data->getStartTime(i), data->getEndTime(i), data->getCableWrapFlag(i), data->getSrcid(i), data->getNSta(i));
-                    break;
-                }
-                case VieVS::AbstractCableWrap::CableWrapFlag::ccw:{
-                    ccw->append(data->at(i).x(), data->at(i).y(), data->getStartTime(i), data->getEndTime(i), data->getCableWrapFlag(i), data->getSrcid(i), data->getNSta(i));
-                    break;
-                }
-                case VieVS::AbstractCableWrap::CableWrapFlag::cw:{
-                    cw->append(data->at(i).x(), data->at(i).y(), data->getStartTime(i), data->getEndTime(i), data->getCableWrapFlag(i), data->getSrcid(i), data->getNSta(i));
-                    break;
+        for(int i=0; i<data->count(); ++i){
+            bool flag1 = data->getStartTime(i) >= start && data->getStartTime(i) <= end;
+            bool flag2 = data->getEndTime(i) >= start && data->getEndTime(i) <= end;
+            bool flag3 = data->getStartTime(i) <= start && data->getEndTime(i) >= end;
+            bool flag = flag1 || flag2 || flag3;
+
+            if(flag){
+                switch(data->getCableWrapFlag(i)){
+                    case VieVS::AbstractCableWrap::CableWrapFlag::n:{
+                        n->append(data->at(i).x(), data->at(i).y(), data->getStartTime(i), data->getEndTime(i), data->getCableWrapFlag(i), data->getSrcid(i), data->getNSta(i));
+                        break;
+                    }
+                    case VieVS::AbstractCableWrap::CableWrapFlag::ccw:{
+                        ccw->append(data->at(i).x(), data->at(i).y(), data->getStartTime(i), data->getEndTime(i), data->getCableWrapFlag(i), data->getSrcid(i), data->getNSta(i));
+                        break;
+                    }
+                    case VieVS::AbstractCableWrap::CableWrapFlag::cw:{
+                        cw->append(data->at(i).x(), data->at(i).y(), data->getStartTime(i), data->getEndTime(i), data->getCableWrapFlag(i), data->getSrcid(i), data->getNSta(i));
+                        break;
+                    }
                 }
             }
         }
     }
 
     on_treeView_skyCoverage_sources_clicked(QModelIndex());
+    updateSkyCoverageRaster(idx);
 }
 
 void VieSchedpp_Analyser::skyCoverageHovered(QPointF point, bool flag)
@@ -1210,20 +1227,10 @@ void VieSchedpp_Analyser::skyCoverageHovered(QPointF point, bool flag)
 
     for(QGraphicsItem *childItem: chart->childItems()){
         if(Callout *c = dynamic_cast<Callout *>(childItem)){
-            if(flag){
+            int idx = flag ? hoverIndex_->nearest(series, point) : -1;
+            if(idx != -1){
                 c->setAnchor(point);
 
-                QString name = series->name();
-                int idx = 0;
-                while(idx<series->count()){
-                    const QPointF &p = series->at(idx);
-
-                    if(point == p){
-                        break;
-                    }
-                    ++idx;
-                }
-
                 int srcid = series->getSrcid(idx);
                 QString source = srcModel->item(srcid,0)->text().append("\n");
                 int startTime = series->getStartTime(idx);
@@ -1334,6 +1341,85 @@ void VieSchedpp_Analyser::on_checkBox_skyCoverageLegend_toggled(bool checked)
 }
 
 
+void VieSchedpp_Analyser::on_checkBox_skyCoverageRaster_toggled(bool checked)
+{
+    updateSkyCoverageTimes();
+}
+
+void VieSchedpp_Analyser::setupSkyCoverageRaster()
+{
+    const std::vector<VieVS::Station> &stations = schedule_.getNetwork().getStations();
+    const std::vector<VieVS::Scan> &scans = schedule_.getScans();
+    int nsta = static_cast<int>(stations.size());
+
+    skyCoverageRaster_ = QVector<SkyCoverageRaster>(nsta);
+    SkyCoverageRaster *rasters = skyCoverageRaster_.data();
+
+    #pragma omp parallel for schedule(dynamic)
+    for(int i=0; i<nsta; ++i){
+        rasters[stations[i].getId()].compute(qtUtil::getObsData(stations[i].getId(), scans));
+    }
+}
+
+void VieSchedpp_Analyser::updateSkyCoverageRaster()
+{
+    if(!ui->checkBox_skyCoverageRaster->isChecked()){
+        return;
+    }
+    for(int i=0; i<ui->gridLayout_skyCoverage->count(); ++i){
+        updateSkyCoverageRaster(i);
+    }
+}
+
+void VieSchedpp_Analyser::updateSkyCoverageRaster(int idx)
+{
+    QGroupBox *box = qobject_cast<QGroupBox*>(ui->gridLayout_skyCoverage->itemAt(idx)->widget());
+    QChartView *chartView = qobject_cast<QChartView*>(box->layout()->itemAt(1)->widget());
+    QComboBox *comboBox = qobject_cast<QComboBox*>(box->children().at(2));
+    QChart *chart = chartView->chart();
+
+    bool rasterMode = ui->checkBox_skyCoverageRaster->isChecked();
+    for(const auto &any : chart->series()){
+        QString name = any->name();
+        if(name == "outside timespan" || name == "ccw" || name == "cw" || name == "n"){
+            any->setVisible(!rasterMode);
+        }
+    }
+
+    QGraphicsPixmapItem *raster = nullptr;
+    for(QGraphicsItem *childItem: chart->childItems()){
+        if(QGraphicsPixmapItem *p = dynamic_cast<QGraphicsPixmapItem *>(childItem)){
+            raster = p;
+            break;
+        }
+    }
+
+    if(!rasterMode || comboBox->currentText().isEmpty()){
+        if(raster != nullptr){
+            raster->hide();
+        }
+        return;
+    }
+
+    if(skyCoverageRaster_.isEmpty()){
+        setupSkyCoverageRaster();
+    }
+    if(raster == nullptr){
+        raster = new QGraphicsPixmapItem(chart);
+        raster->setZValue(1.5); // above shades, below grid and series
+    }
+
+    unsigned long staid = schedule_.getNetwork().getStation(comboBox->currentText().toStdString()).getId();
+    QRectF area = chart->plotArea();
+    int size = static_cast<int>(std::min(area.width(), area.height()));
+    int start = ui->horizontalSlider_start->value();
+    int end = ui->horizontalSlider_end->value();
+
+    raster->setPixmap(QPixmap::fromImage(skyCoverageRaster_[staid].render(size, start, end)));
+    raster->setPos(area.center() - QPointF(size/2.0, size/2.0));
+    raster->show();
+}
+
 void VieSchedpp_Analyser::setupWorldmap()
 {
     ChartView *worldmap = new ChartView(this);
@@ -1359,11 +1445,14 @@ void VieSchedpp_Analyser::setupWorldmap()
     connect(observingStations,SIGNAL(hovered(QPointF,bool)),this,SLOT(worldmap_hovered(QPointF,bool)));
 
     const std::vector<VieVS::Station> &stations = schedule_.getNetwork().getStations();
+    QVector<QPointF> stationPositions;
     for(const VieVS::Station &station : stations){
         double lat = station.getPosition()->getLat()*rad2deg;
         double lon = station.getPosition()->getLon()*rad2deg;
         selectedStations->append(lon,lat);
+        stationPositions.append(QPointF(lon,lat));
     }
+    worldmapStationIndex_.build(stationPositions);
     for(int i=0; i<stations.size(); ++i){
         double lat1 = stations.at(i).getPosition()->getLat()*rad2deg;
         double lon1 = stations.at(i).getPosition()->getLon()*rad2deg;
@@ -1415,33 +1504,27 @@ void VieSchedpp_Analyser::worldmap_hovered(QPointF point, bool state)
                 QString scans;
                 QString obs;
                 const std::vector<VieVS::Station> &stations = schedule_.getNetwork().getStations();
-                for(const VieVS::Station &station : stations){
-                    double y = station.getPosition()->getLat()*rad2deg;
-                    double x = station.getPosition()->getLon()*rad2deg;
-
-                    auto dx = x-point.x();
-                    auto dy = y-point.y();
-                    if(dx*dx+dy*dy < 1e-3){
-                        if(sta.size()==0){
-                            sta.append(QString("%1 (%2)").arg(QString::fromStdString(station.getName())).arg(QString::fromStdString(station.getAlternativeName())));
-                        }else{
-                            sta.append(QString(", %1 (%2)").arg(QString::fromStdString(station.getName())).arg(QString::fromStdString(station.getAlternativeName())));
-                        }
-                        auto stations = staModel->findItems(QString::fromStdString(station.getName()));
-                        int row = stations.at(0)->row();
-                        QString nscans = staModel->item(row,2)->text();
-                        QString nobs = staModel->item(row,3)->text();
-
-                        if(scans.size()==0){
-                            scans.append(QString("%1").arg(nscans));
-                        }else{
-                            scans.append(QString(", %1").arg(nscans));
-                        }
-                        if(obs.size()==0){
-                            obs.append(QString("%1").arg(nobs));
-                        }else{
-                            obs.append(QString(", %1").arg(nobs));
-                        }
+                for(int i : worldmapStationIndex_.within(point, 1e-3)){
+                    const VieVS::Station &station = stations[i];
+                    if(sta.size()==0){
+                        sta.append(QString("%1 (%2)").arg(QString::fromStdString(station.getName())).arg(QString::fromStdString(station.getAlternativeName())));
+                    }else{
+                        sta.append(QString(", %1 (%2)").arg(QString::fromStdString(station.getName())).arg(QString::fromStdString(station.getAlternativeName())));
+                    }
+                    auto stations = staModel->findItems(QString::fromStdString(station.getName()));
+                    int row = stations.at(0)->row();
+                    QString nscans = staModel->item(row,2)->text();
+                    QString nobs = staModel->item(row,3)->text();
+
+                    if(scans.size()==0){
+                        scans.append(QString("%1").arg(nscans));
+                    }else{
+                        scans.append(QString(", %1").arg(nscans));
+                    }
+                    if(obs.size()==0){
+                        obs.append(QString("%1").arg(nobs));
+                    }else{
+                        obs.append(QString(", %1").arg(nobs));
                     }
                 }
 
@@ -1525,6 +1608,7 @@ void VieSchedpp_Analyser::setupSkymap()
     connect(observedSources,SIGNAL(hovered(QPointF,bool)),this,SLOT(skymap_hovered(QPointF,bool)));
 
     const auto &sources = schedule_.getSourceList().getQuasars();
+    QVector<QPointF> sourcePositions;
     for(const auto &source : sources){
         double ra = source->getRa();
         double lambda = ra;
@@ -1534,7 +1618,9 @@ void VieSchedpp_Analyser::setupSkymap()
         auto xy = qtUtil::radec2xy(lambda, phi);
 
         selectedSources->append(xy.first, xy.second);
+        sourcePositions.append(QPointF(xy.first, xy.second));
     }
+    skymapSourceIndex_.build(sourcePositions);
     Callout *callout = new Callout(skyChart);
     callout->hide();
 
@@ -1558,21 +1644,15 @@ void VieSchedpp_Analyser::skymap_hovered(QPointF point, bool state)
             if (state) {
                 const auto &sources = schedule_.getSourceList().getQuasars();
                 QString text;
-                for(const auto &source : sources){
+                int isrc = skymapSourceIndex_.nearest(point, 1e-3);
+                if(isrc != -1){
+                    const auto &source = sources[isrc];
                     double ra = source->getRa();
                     double dec = source->getDe();
-
-                    auto xy = qtUtil::radec2xy(ra, dec);
-
-                    auto dx = xy.first-point.x();
-                    auto dy = xy.second-point.y();
-                    if(dx*dx+dy*dy < 1e-3){
-                        if(source->hasAlternativeName()){
-                            text = QString("%1 (%2)\n#scans %3 \n#obs %4\nra %5 [deg] \ndec %6 [deg] ").arg(QString::fromStdString(source->getName())).arg(QString::fromStdString(source->getAlternativeName())).arg(source->getNscans()).arg(source->getNObs()).arg(ra*rad2deg).arg(dec*rad2deg);
-                        }else{
-                            text = QString("%1 \n#scans %2 \n#obs %3\nra %4 [deg] \ndec %5 [deg] ").arg(QString::fromStdString(source->getName())).arg(source->getNscans()).arg(source->getNObs()).arg(ra*rad2deg).arg(dec*rad2deg);
-                        }
-                        break;
+                    if(source->hasAlternativeName()){
+                        text = QString("%1 (%2)\n#scans %3 \n#obs %4\nra %5 [deg] \ndec %6 [deg] ").arg(QString::fromStdString(source->getName())).arg(QString::fromStdString(source->getAlternativeName())).arg(source->getNscans()).arg(source->getNObs()).arg(ra*rad2deg).arg(dec*rad2deg);
+                    }else{
+                        text = QString("%1 \n#scans %2 \n#obs %3\nra %4 [deg] \ndec %5 [deg] ").arg(QString::fromStdString(source->getName())).arg(source->getNscans()).arg(source->getNObs()).arg(ra*rad2deg).arg(dec*rad2deg);
                     }
                 }
 
@@ -1984,7 +2064,7 @@ void VieSchedpp_Analyser::updateWorldmapTimes()
                     series->append(staModel->index(i,5).data().toDouble(), staModel->index(i,4).data().toDouble());
                 }
             }
-        }else if(any->name() != "stations" && any->name() != "coast" ){
+        }else if(any->name() != "stations"){
             QString name = any->name().left(5);
 
             int row = blModel->findItems(name).at(0)->row();
@@ -2533,7 +2613,8 @@ void VieSchedpp_Analyser::statisticsSourceSetup()
     chart->addAxis(axisY, Qt::AlignLeft);
 
 
-    QChartView *chartView = new QChartView(chart);
+    ChartView *chartView = new ChartView(chart);
+    chartView->setRubberBand(QChartView::HorizontalRubberBand);
     chartView->setRenderHint(QPainter::Antialiasing);
 
     QList<QColor> c;
@@ -2586,6 +2667,7 @@ void VieSchedpp_Analyser::statisticsSourceSetup()
     callout->hide();
 
     ui->horizontalLayout_statistics_source->insertWidget(0,chartView,1);
+    elevationDownsampler_ = new SeriesDownsampler(chart);
 
     ui->treeView_statistics_source->setCurrentIndex(ui->treeView_statistics_source->model()->index(0,0));
     connect(ui->treeView_statistics_source->selectionModel(),SIGNAL(selectionChanged(QItemSelection,QItemSelection)),SLOT(updateStatisticsSource()));
@@ -2630,8 +2712,8 @@ void VieSchedpp_Analyser::updateStatisticsSource()
                 break;
             }
         }
-        serie->clear();
-
+        QVector<QPointF> points;
+        points.reserve(ui->horizontalSlider_end->maximum()/300+2);
         for(int i = 0; i<=ui->horizontalSlider_end->maximum()+300; i+=300){
             QDateTime t = sessionStart_.addSecs(i);
 
@@ -2640,8 +2722,9 @@ void VieSchedpp_Analyser::updateStatisticsSource()
 
             sta.calcAzEl_rigorous(src,pv);
             double el = pv.getEl()*rad2deg;
-            serie->append(t.toMSecsSinceEpoch(),el);
+            points.append(QPointF(t.toMSecsSinceEpoch(),el));
         }
+        elevationDownsampler_->setData(serie, points);
 
         serie->attachAxis(chart->axisX());
         serie->attachAxis(chart->axisY());
@@ -3495,19 +3578,10 @@ void VieSchedpp_Analyser::uvHovered(QPointF point, bool flag)
 
     for(QGraphicsItem *childItem: chart->childItems()){
         if(Callout *c = dynamic_cast<Callout *>(childItem)){
-            if(flag){
+            int idx = flag ? hoverIndex_->nearest(series, point) : -1;
+            if(idx != -1){
                 c->setAnchor(point);
 
-                int idx = 0;
-                while(idx<series->count()){
-                    const QPointF &p = series->at(idx);
-
-                    if(point == p){
-                        break;
-                    }
-                    ++idx;
-                }
-
                 int startTime = series->getStartTime(idx);
                 int endTime = series->getEndTime(idx);
 
@@ -3588,6 +3662,55 @@ void VieSchedpp_Analyser::updateUVTimes(int idx)
 }
 
 
+void VieSchedpp_Analyser::on_actioncompare_triggered()
+{
+    QString txt = ui->label_fileName->text();
+    int idx = txt.lastIndexOf("/");
+    if(idx == -1){
+        idx = txt.lastIndexOf("\\");
+    }
+    txt = txt.left(idx);
+
+    QString path = QFileDialog::getOpenFileName(this, "Browse to schedule", txt, tr("sked file (*.skd)"));
+    if(path.isEmpty()){
+        return;
+    }
+
+    // parsing a schedule overwrites the global session times - restore them afterwards
+    auto backupStartTime = VieVS::TimeSystem::startTime;
+    auto backupEndTime = VieVS::TimeSystem::endTime;
+    auto backupMjdStart = VieVS::TimeSystem::mjdStart;
+    auto backupDuration = VieVS::TimeSystem::duration;
+
+    try{
+        VieVS::SkdParser mySkdParser(path.toStdString());
+        mySkdParser.read();
+        VieVS::Scheduler other = mySkdParser.createScheduler();
+
+        std::string start = VieVS::TimeSystem::time2string(VieVS::TimeSystem::startTime);
+        std::string end = VieVS::TimeSystem::time2string(VieVS::TimeSystem::endTime);
+        QDateTime qstart = QDateTime::fromString(QString::fromStdString(start),"yyyy.MM.dd HH:mm:ss");
+        QDateTime qend   = QDateTime::fromString(QString::fromStdString(end),"yyyy.MM.dd HH:mm:ss");
+
+        VieVS::TimeSystem::startTime = backupStartTime;
+        VieVS::TimeSystem::endTime = backupEndTime;
+        VieVS::TimeSystem::mjdStart = backupMjdStart;
+        VieVS::TimeSystem::duration = backupDuration;
+
+        VieSchedpp_Comparator *comparator = new VieSchedpp_Comparator(schedule_, sessionStart_, sessionEnd_, other, qstart, qend, this);
+        comparator->show();
+
+    }catch(...){
+        VieVS::TimeSystem::startTime = backupStartTime;
+        VieVS::TimeSystem::endTime = backupEndTime;
+        VieVS::TimeSystem::mjdStart = backupMjdStart;
+        VieVS::TimeSystem::duration = backupDuration;
+
+        QString message = QString("Error reading session:\n").append(path);
+        QMessageBox::critical(this, "error reading session", message);
+    }
+}
+
 void VieSchedpp_Analyser::on_pushButton_30min_clicked()
 {
     ui->doubleSpinBox_hours->setValue(0.25);
@@ -49,8 +49,12 @@
 #include <QMessageBox>
 #include <QProgressBar>
 #include <QDesktopServices>
+#include <QGraphicsPixmapItem>
+
+#include <QFileDialog>
 
 #include <secondaryGUIs/rendersetup.h>
+#include <secondaryGUIs/vieschedpp_comparator.h>
 
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics/stats.hpp>
@@ -62,8 +66,13 @@
 #include <boost/accumulators/statistics/tail_quantile.hpp>
 
 #include "../VieSchedpp/Scheduler.h"
+#include "../VieSchedpp/Input/SkdParser.h"
 #include "Utility/qtutil.h"
 #include "Utility/callout.h"
+#include "Utility/skycoverageraster.h"
+#include "Utility/seriesdownsampler.h"
+#include "Utility/pointindex.h"
+#include "Utility/chartview.h"
 
 QT_CHARTS_USE_NAMESPACE
 
@@ -171,6 +180,14 @@ private slots:
 
     void on_checkBox_skyCoverageLegend_toggled(bool checked);
 
+    void on_checkBox_skyCoverageRaster_toggled(bool checked);
+
+    void setupSkyCoverageRaster();
+
+    void updateSkyCoverageRaster();
+
+    void updateSkyCoverageRaster(int idx);
+
     void statisticsStationsSetup();
 
     void updateStatisticsStations();
@@ -250,6 +267,8 @@ private slots:
 
     void on_pushButton_el_screenshot_clicked();
 
+    void on_actioncompare_triggered();
+
 private:
     Ui::VieSchedpp_Analyser *ui;
 
@@ -265,6 +284,14 @@ private:
 
     QList<int> histogram_upperLimits_;
 
+    SeriesPointIndex *hoverIndex_;                 ///< hit-testing of sky coverage and uv points
+    PointIndex worldmapStationIndex_;              ///< station (lon, lat) in network order
+    PointIndex skymapSourceIndex_;                 ///< source position on sky map in order of getQuasars()
+
+    SeriesDownsampler *elevationDownsampler_;      ///< full resolution elevation traces of statistics per source
+
+    QVector<SkyCoverageRaster> skyCoverageRaster_; ///< observation density per station id, computed on first use
+
 //    QSignalMapper *comboBox2skyCoverage;
 
 };
@@ -0,0 +1,517 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "secondaryGUIs/vieschedpp_comparator.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QGraphicsLayout>
+#include <numeric>
+
+namespace{
+    const QColor colorA = QColor(228,26,28);
+    const QColor colorB = QColor(55,126,184);
+}
+
+VieSchedpp_Comparator::VieSchedpp_Comparator(const VieVS::Scheduler &scheduleA, QDateTime startA, QDateTime endA,
+                                             const VieVS::Scheduler &scheduleB, QDateTime startB, QDateTime endB,
+                                             QWidget *parent) :
+    QMainWindow(parent)
+{
+    this->setWindowTitle("VieSched++ Analyzer - compare schedules");
+    setAttribute(Qt::WA_DeleteOnClose);
+
+    nameA_ = QString::fromStdString(scheduleA.getName());
+    nameB_ = QString::fromStdString(scheduleB.getName());
+    nameA_ = nameA_.mid(std::max(nameA_.lastIndexOf('/'), nameA_.lastIndexOf('\\'))+1);
+    nameB_ = nameB_.mid(std::max(nameB_.lastIndexOf('/'), nameB_.lastIndexOf('\\'))+1);
+    if(nameA_ == nameB_){
+        nameA_.append(" (1)");
+        nameB_.append(" (2)");
+    }
+
+    refStart_ = std::min(startA, startB);
+    refEnd_ = std::max(endA, endB);
+    int offsetA = refStart_.secsTo(startA);
+    int offsetB = refStart_.secsTo(startB);
+
+    auto toMjd = [](const QDateTime &t){
+        return static_cast<double>(t.date().toJulianDay()) - 2400001 +
+                (t.time().second() + t.time().minute()*60 + t.time().hour()*3600)/86400.0;
+    };
+
+    mergeSchedules(scheduleA, offsetA, toMjd(startA), scheduleB, offsetB, toMjd(startB));
+    setupLayout();
+    updateAll();
+}
+
+int VieSchedpp_Comparator::registerName(const QString &name, QStringList &names, QHash<QString, int> &lookup)
+{
+    auto it = lookup.constFind(name);
+    if(it != lookup.constEnd()){
+        return it.value();
+    }
+    int idx = names.size();
+    names.append(name);
+    lookup.insert(name, idx);
+    return idx;
+}
+
+void VieSchedpp_Comparator::mergeSchedules(const VieVS::Scheduler &scheduleA, int offsetA, double mjdA,
+                                           const VieVS::Scheduler &scheduleB, int offsetB, double mjdB)
+{
+    const std::vector<VieVS::Scan> &scansA = scheduleA.getScans();
+    const std::vector<VieVS::Scan> &scansB = scheduleB.getScans();
+    scans_.reserve(static_cast<int>(scansA.size() + scansB.size()));
+
+    // both scan lists are already sorted by start time -> a single merge pass keeps the shared index sorted
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while(i < scansA.size() || j < scansB.size()){
+        bool takeA;
+        if(i == scansA.size()){
+            takeA = false;
+        }else if(j == scansB.size()){
+            takeA = true;
+        }else{
+            int tA = static_cast<int>(scansA[i].getTimes().getObservingTime(VieVS::Timestamp::start)) + offsetA;
+            int tB = static_cast<int>(scansB[j].getTimes().getObservingTime(VieVS::Timestamp::start)) + offsetB;
+            takeA = tA <= tB;
+        }
+
+        if(takeA){
+            addScan(scheduleA, scansA[i], 0, offsetA, mjdA);
+            ++i;
+        }else{
+            addScan(scheduleB, scansB[j], 1, offsetB, mjdB);
+            ++j;
+        }
+    }
+}
+
+void VieSchedpp_Comparator::addScan(const VieVS::Scheduler &schedule, const VieVS::Scan &scan, int schedIdx, int offset, double mjdStart)
+{
+    const VieVS::Network &network = schedule.getNetwork();
+    const auto &sources = schedule.getSourceList().getSources();
+    const auto &source = sources.at(scan.getSourceId());
+
+    ComparedScan c;
+    c.start = static_cast<int>(scan.getTimes().getObservingTime(VieVS::Timestamp::start)) + offset;
+    c.end = static_cast<int>(scan.getTimes().getObservingTime(VieVS::Timestamp::end)) + offset;
+    c.schedule = schedIdx;
+    c.srcid = registerName(QString::fromStdString(source->getName()), srcNames_, src2idx_);
+    if(uv_.size() < srcNames_.size()){
+        uv_.resize(srcNames_.size());
+    }
+    maxScanDuration_ = std::max(maxScanDuration_, c.end-c.start);
+
+    for(int k = 0; k<scan.getNSta(); ++k){
+        const VieVS::PointingVector &pv = scan.getPointingVector(k, VieVS::Timestamp::start);
+        const VieVS::Station &sta = network.getStation(pv.getStaid());
+        int staid = registerName(QString::fromStdString(sta.getName()), staNames_, sta2idx_);
+        if(sky_.size() < staNames_.size()){
+            sky_.resize(staNames_.size());
+        }
+        c.staids.append(staid);
+
+        double az = VieVS::util::wrap2twoPi(pv.getAz())*rad2deg;
+        if(az<0){
+            az+=360;
+        }
+        ComparedPoint p;
+        p.x = az;
+        p.y = 90-pv.getEl()*rad2deg;
+        p.start = static_cast<int>(pv.getTime()) + offset;
+        p.end = static_cast<int>(scan.getPointingVector(k, VieVS::Timestamp::end).getTime()) + offset;
+        p.schedule = schedIdx;
+        sky_[staid].append(p);
+    }
+
+    for(const VieVS::Observation &obs: scan.getObservations()){
+        unsigned long staid1 = obs.getStaid1();
+        unsigned long staid2 = obs.getStaid2();
+        QString name1 = QString::fromStdString(network.getStation(staid1).getName());
+        QString name2 = QString::fromStdString(network.getStation(staid2).getName());
+        int sta1 = registerName(name1, staNames_, sta2idx_);
+        int sta2 = registerName(name2, staNames_, sta2idx_);
+
+        // station order within a baseline may differ between the two schedules
+        QString alt1 = QString::fromStdString(network.getStation(staid1).getAlternativeName());
+        QString alt2 = QString::fromStdString(network.getStation(staid2).getAlternativeName());
+        QString bl = alt1 < alt2 ? alt1 + "-" + alt2 : alt2 + "-" + alt1;
+        int blid = registerName(bl, blNames_, bl2idx_);
+        if(bl2sta_.size() < blNames_.size()){
+            bl2sta_.append(qMakePair(sta1, sta2));
+        }
+        c.blids.append(blid);
+
+        const std::vector<double> &dxyz = network.getDxyz(staid1,staid2);
+        double mjd = mjdStart + obs.getStartTime()/86400.0;
+        double gmst  = iauGmst82(2400000.5,mjd);
+        std::pair<double, double> uv = source->calcUV(obs.getStartTime(), gmst, dxyz);
+
+        ComparedPoint p;
+        p.start = static_cast<int>(obs.getStartTime()) + offset;
+        p.end = p.start + static_cast<int>(obs.getObservingTime());
+        p.schedule = schedIdx;
+        p.x = uv.first  * 1e-6;
+        p.y = uv.second * 1e-6;
+        uv_[c.srcid].append(p);
+        p.x = -p.x;
+        p.y = -p.y;
+        uv_[c.srcid].append(p);
+    }
+
+    scans_.append(c);
+}
+
+void VieSchedpp_Comparator::setupLayout()
+{
+    QWidget *central = new QWidget(this);
+    QVBoxLayout *mainLayout = new QVBoxLayout(central);
+
+    int duration = refStart_.secsTo(refEnd_);
+    QHBoxLayout *timeLayout = new QHBoxLayout();
+    slider_start = new QSlider(Qt::Horizontal, central);
+    slider_end = new QSlider(Qt::Horizontal, central);
+    slider_start->setRange(0, duration);
+    slider_end->setRange(0, duration);
+    slider_start->setValue(0);
+    slider_end->setValue(duration);
+    label_start = new QLabel(refStart_.toString("dd.MM.yyyy hh:mm:ss"), central);
+    label_end = new QLabel(refEnd_.toString("dd.MM.yyyy hh:mm:ss"), central);
+    timeLayout->addWidget(label_start);
+    timeLayout->addWidget(slider_start, 1);
+    timeLayout->addWidget(slider_end, 1);
+    timeLayout->addWidget(label_end);
+    mainLayout->addLayout(timeLayout);
+
+    QLabel *legend = new QLabel(QString("<font color=\"%1\">&#9632; %2</font> &nbsp; <font color=\"%3\">&#9632; %4</font>")
+                                .arg(colorA.name()).arg(nameA_).arg(colorB.name()).arg(nameB_), central);
+    mainLayout->addWidget(legend);
+
+    tabs = new QTabWidget(central);
+    mainLayout->addWidget(tabs, 1);
+
+    // statistics
+    QWidget *statWidget = new QWidget(tabs);
+    QVBoxLayout *statLayout = new QVBoxLayout(statWidget);
+    QHBoxLayout *statControl = new QHBoxLayout();
+    comboBox_statistics_category = new QComboBox(statWidget);
+    comboBox_statistics_category->addItems({"stations", "sources", "baselines"});
+    comboBox_statistics_type = new QComboBox(statWidget);
+    comboBox_statistics_type->addItems({"#scans", "#obs"});
+    statControl->addWidget(comboBox_statistics_category);
+    statControl->addWidget(comboBox_statistics_type);
+    statControl->addStretch(1);
+    statLayout->addLayout(statControl);
+    QHBoxLayout *statCharts = new QHBoxLayout();
+    barView = new QChartView(new QChart(), statWidget);
+    barView->setRenderHint(QPainter::Antialiasing);
+    pieView = new QChartView(new QChart(), statWidget);
+    pieView->setRenderHint(QPainter::Antialiasing);
+    statCharts->addWidget(barView, 3);
+    statCharts->addWidget(pieView, 1);
+    statLayout->addLayout(statCharts, 1);
+    tabs->addTab(statWidget, QIcon(":/icons/icons/office-chart-bar.png"), "differences");
+
+    // sky coverage
+    QWidget *skyWidget = new QWidget(tabs);
+    QVBoxLayout *skyLayout = new QVBoxLayout(skyWidget);
+    comboBox_skyCoverage = new QComboBox(skyWidget);
+    QStringList sortedSta = staNames_;
+    sortedSta.sort();
+    comboBox_skyCoverage->addItems(sortedSta);
+    skyLayout->addWidget(comboBox_skyCoverage);
+    QPolarChart *polar = new QPolarChart();
+    polar->setAnimationOptions(QPolarChart::NoAnimation);
+    polar->layout()->setContentsMargins(0, 0, 0, 0);
+    polar->setBackgroundRoundness(0);
+    QValueAxis *angularAxis = new QValueAxis();
+    angularAxis->setTickCount(13); // First and last ticks are co-located on 0/360 angle.
+    angularAxis->setLabelFormat("%.0f");
+    angularAxis->setShadesVisible(true);
+    angularAxis->setShadesBrush(QBrush(QColor(230, 238, 255)));
+    angularAxis->setRange(0,360);
+    polar->addAxis(angularAxis, QPolarChart::PolarOrientationAngular);
+    QValueAxis *radialAxis = new QValueAxis();
+    radialAxis->setTickCount(10);
+    radialAxis->setRange(0,90);
+    radialAxis->setLabelFormat(" ");
+    polar->addAxis(radialAxis, QPolarChart::PolarOrientationRadial);
+    skyView = new QChartView(polar, skyWidget);
+    skyView->setRenderHint(QPainter::Antialiasing);
+    skyLayout->addWidget(skyView, 1);
+    tabs->addTab(skyWidget, QIcon(":/icons/icons/sky_coverage_analyser.png"), "sky-coverage");
+
+    // uv coverage
+    QWidget *uvWidget = new QWidget(tabs);
+    QVBoxLayout *uvLayout = new QVBoxLayout(uvWidget);
+    comboBox_uv = new QComboBox(uvWidget);
+    QStringList sortedSrc = srcNames_;
+    sortedSrc.sort();
+    comboBox_uv->addItems(sortedSrc);
+    uvLayout->addWidget(comboBox_uv);
+    QChart *uvChart = new QChart();
+    uvChart->setAnimationOptions(QChart::NoAnimation);
+    uvChart->layout()->setContentsMargins(0, 0, 0, 0);
+    uvChart->setBackgroundRoundness(0);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    axisX->setRange(-13,13);
+    axisY->setRange(-13,13);
+    axisX->setTitleText("u [1000 km]");
+    axisY->setTitleText("v [1000 km]");
+    uvChart->addAxis(axisY, Qt::AlignLeft);
+    uvChart->addAxis(axisX, Qt::AlignBottom);
+    uvView = new QChartView(uvChart, uvWidget);
+    uvView->setRenderHint(QPainter::Antialiasing);
+    uvLayout->addWidget(uvView, 1);
+    tabs->addTab(uvWidget, QIcon(":/icons/icons/uv.png"), "uv-coverage");
+
+    setCentralWidget(central);
+    resize(1200, 800);
+
+    connect(slider_start, SIGNAL(valueChanged(int)), this, SLOT(sliderStartChanged(int)));
+    connect(slider_end, SIGNAL(valueChanged(int)), this, SLOT(sliderEndChanged(int)));
+    connect(comboBox_statistics_category, SIGNAL(currentIndexChanged(int)), this, SLOT(updateStatistics()));
+    connect(comboBox_statistics_type, SIGNAL(currentIndexChanged(int)), this, SLOT(updateStatistics()));
+    connect(comboBox_skyCoverage, SIGNAL(currentIndexChanged(int)), this, SLOT(updateSkyCoverage()));
+    connect(comboBox_uv, SIGNAL(currentIndexChanged(int)), this, SLOT(updateUVCoverage()));
+}
+
+void VieSchedpp_Comparator::sliderStartChanged(int value)
+{
+    if(slider_end->value() < value){
+        slider_end->setValue(value);
+    }
+    label_start->setText(refStart_.addSecs(value).toString("dd.MM.yyyy hh:mm:ss"));
+    updateAll();
+}
+
+void VieSchedpp_Comparator::sliderEndChanged(int value)
+{
+    if(slider_start->value() > value){
+        slider_start->setValue(value);
+    }
+    label_end->setText(refStart_.addSecs(value).toString("dd.MM.yyyy hh:mm:ss"));
+    updateAll();
+}
+
+void VieSchedpp_Comparator::updateAll()
+{
+    updateStatistics();
+    updateSkyCoverage();
+    updateUVCoverage();
+}
+
+QPair<int, int> VieSchedpp_Comparator::scanRange(int start, int end) const
+{
+    // scans_ is sorted by start time: every scan touching [start, end] starts within [start-maxScanDuration_, end]
+    auto cmp = [](const ComparedScan &s, int t){ return s.start < t; };
+    auto first = std::lower_bound(scans_.begin(), scans_.end(), start-maxScanDuration_, cmp);
+    auto last = std::upper_bound(scans_.begin(), scans_.end(), end,
+                                 [](int t, const ComparedScan &s){ return t < s.start; });
+    return qMakePair(static_cast<int>(first-scans_.begin()), static_cast<int>(last-scans_.begin()));
+}
+
+void VieSchedpp_Comparator::updateStatistics()
+{
+    int category = comboBox_statistics_category->currentIndex();
+    bool obs = comboBox_statistics_type->currentIndex() == 1;
+
+    const QStringList &names = category == 0 ? staNames_ : (category == 1 ? srcNames_ : blNames_);
+    QVector<int> a(names.size(), 0);
+    QVector<int> b(names.size(), 0);
+
+    int start = slider_start->value();
+    int end = slider_end->value();
+    QPair<int, int> range = scanRange(start, end);
+    for(int i=range.first; i<range.second; ++i){
+        const ComparedScan &scan = scans_[i];
+        if(!inWindow(scan.start, scan.end, start, end)){
+            continue;
+        }
+        QVector<int> &v = scan.schedule == 0 ? a : b;
+        switch(category){
+            case 0:{
+                if(obs){
+                    for(int bl : scan.blids){
+                        ++v[bl2sta_[bl].first];
+                        ++v[bl2sta_[bl].second];
+                    }
+                }else{
+                    for(int sta : scan.staids){
+                        ++v[sta];
+                    }
+                }
+                break;
+            }
+            case 1:{
+                v[scan.srcid] += obs ? scan.blids.size() : 1;
+                break;
+            }
+            default:{
+                for(int bl : scan.blids){
+                    ++v[bl];
+                }
+                break;
+            }
+        }
+    }
+
+    // show the entries with the largest differences first
+    QVector<int> order(names.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int i1, int i2){
+        return std::abs(a[i1]-b[i1]) > std::abs(a[i2]-b[i2]);
+    });
+
+    int moreA = 0;
+    int moreB = 0;
+    int equal = 0;
+    for(int i=0; i<names.size(); ++i){
+        if(a[i] > b[i]){
+            ++moreA;
+        }else if(a[i] < b[i]){
+            ++moreB;
+        }else{
+            ++equal;
+        }
+    }
+
+    const int maxBars = 30;
+    QBarSet *setA = new QBarSet(nameA_);
+    QBarSet *setB = new QBarSet(nameB_);
+    setA->setColor(colorA);
+    setB->setColor(colorB);
+    QStringList categories;
+    int maxVal = 0;
+    for(int i=0; i<std::min(maxBars, order.size()); ++i){
+        int idx = order[i];
+        categories << names[idx];
+        *setA << a[idx];
+        *setB << b[idx];
+        maxVal = std::max({maxVal, a[idx], b[idx]});
+    }
+    QBarSeries *series = new QBarSeries();
+    series->append(setA);
+    series->append(setB);
+
+    QChart *barChart = barView->chart();
+    barChart->removeAllSeries();
+    for(auto axis : barChart->axes()){
+        barChart->removeAxis(axis);
+        delete axis;
+    }
+    barChart->addSeries(series);
+    QBarCategoryAxis *axisX = new QBarCategoryAxis();
+    axisX->append(categories);
+    axisX->setLabelsAngle(-90);
+    QValueAxis *axisY = new QValueAxis();
+    axisY->setRange(0, std::max(1, maxVal));
+    axisY->setTitleText(comboBox_statistics_type->currentText());
+    barChart->addAxis(axisX, Qt::AlignBottom);
+    barChart->addAxis(axisY, Qt::AlignLeft);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    barChart->setTitle(QString("largest differences per %1").arg(comboBox_statistics_category->currentText().left(comboBox_statistics_category->currentText().size()-1)));
+
+    QPieSeries *pie = new QPieSeries();
+    QPieSlice *sliceA = pie->append(QString("more in %1: %2").arg(nameA_).arg(moreA), moreA);
+    QPieSlice *sliceEqual = pie->append(QString("equal: %1").arg(equal), equal);
+    QPieSlice *sliceB = pie->append(QString("more in %1: %2").arg(nameB_).arg(moreB), moreB);
+    sliceA->setColor(colorA);
+    sliceEqual->setColor(Qt::gray);
+    sliceB->setColor(colorB);
+
+    QChart *pieChart = pieView->chart();
+    pieChart->removeAllSeries();
+    pieChart->addSeries(pie);
+    pieChart->legend()->setAlignment(Qt::AlignBottom);
+}
+
+void VieSchedpp_Comparator::updateSkyCoverage()
+{
+    QChart *chart = skyView->chart();
+    chart->removeAllSeries();
+    auto it = sta2idx_.constFind(comboBox_skyCoverage->currentText());
+    if(it == sta2idx_.constEnd()){
+        return;
+    }
+
+    QScatterSeries *sA = new QScatterSeries();
+    QScatterSeries *sB = new QScatterSeries();
+    sA->setName(nameA_);
+    sB->setName(nameB_);
+    sA->setBrush(colorA);
+    sB->setBrush(colorB);
+    sA->setMarkerSize(7);
+    sB->setMarkerSize(7);
+
+    int start = slider_start->value();
+    int end = slider_end->value();
+    for(const ComparedPoint &p : sky_[it.value()]){
+        if(inWindow(p.start, p.end, start, end)){
+            (p.schedule == 0 ? sA : sB)->append(p.x, p.y);
+        }
+    }
+
+    chart->addSeries(sA);
+    chart->addSeries(sB);
+    for(auto axis : chart->axes()){
+        sA->attachAxis(axis);
+        sB->attachAxis(axis);
+    }
+}
+
+void VieSchedpp_Comparator::updateUVCoverage()
+{
+    QChart *chart = uvView->chart();
+    chart->removeAllSeries();
+    auto it = src2idx_.constFind(comboBox_uv->currentText());
+    if(it == src2idx_.constEnd()){
+        return;
+    }
+
+    QScatterSeries *sA = new QScatterSeries();
+    QScatterSeries *sB = new QScatterSeries();
+    sA->setName(nameA_);
+    sB->setName(nameB_);
+    sA->setBrush(colorA);
+    sB->setBrush(colorB);
+    sA->setBorderColor(colorA);
+    sB->setBorderColor(colorB);
+    sA->setMarkerSize(4);
+    sB->setMarkerSize(4);
+
+    int start = slider_start->value();
+    int end = slider_end->value();
+    for(const ComparedPoint &p : uv_[it.value()]){
+        if(inWindow(p.start, p.end, start, end)){
+            (p.schedule == 0 ? sA : sB)->append(p.x, p.y);
+        }
+    }
+
+    chart->addSeries(sA);
+    chart->addSeries(sB);
+    for(auto axis : chart->axes()){
+        sA->attachAxis(axis);
+        sB->attachAxis(axis);
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIESCHEDPP_COMPARATOR_H
+#define VIESCHEDPP_COMPARATOR_H
+
+#include <QMainWindow>
+#include <QDateTime>
+#include <QComboBox>
+#include <QSlider>
+#include <QLabel>
+#include <QTabWidget>
+#include <QHash>
+#include <QtCharts/QChartView>
+#include <QtCharts/QPolarChart>
+#include <QtCharts/QValueAxis>
+#include <QtCharts/QScatterSeries>
+#include <QtCharts/QPieSeries>
+#include <QtCharts/QBarSeries>
+#include <QtCharts/QBarSet>
+#include <QtCharts/QBarCategoryAxis>
+
+#include "../VieSchedpp/Scheduler.h"
+
+QT_CHARTS_USE_NAMESPACE
+
+/**
+ * @brief side by side comparison of two schedules
+ *
+ * Both scan lists are merged once into a shared time index (seconds since the earlier of the two session starts).
+ * All plots are derived from this index, therefore moving the sliders only filters the merged data and never touches
+ * the original schedules again.
+ */
+class VieSchedpp_Comparator : public QMainWindow
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief one scan of either schedule on the shared time axis
+     */
+    struct ComparedScan{
+        int start;              ///< scan start [s] since shared reference epoch
+        int end;                ///< scan end [s] since shared reference epoch
+        int schedule;           ///< 0 for first schedule, 1 for second schedule
+        int srcid;              ///< index in merged source list
+        QVector<int> staids;    ///< indices in merged station list
+        QVector<int> blids;     ///< indices in merged baseline list (one entry per observation)
+    };
+
+    /**
+     * @brief one sky coverage or uv point on the shared time axis
+     */
+    struct ComparedPoint{
+        double x;               ///< azimuth [deg] or u [1000 km]
+        double y;               ///< 90-elevation [deg] or v [1000 km]
+        int start;              ///< start [s] since shared reference epoch
+        int end;                ///< end [s] since shared reference epoch
+        int schedule;           ///< 0 for first schedule, 1 for second schedule
+    };
+
+    explicit VieSchedpp_Comparator(const VieVS::Scheduler &scheduleA, QDateTime startA, QDateTime endA,
+                                   const VieVS::Scheduler &scheduleB, QDateTime startB, QDateTime endB,
+                                   QWidget *parent = 0);
+
+private slots:
+
+    void sliderStartChanged(int value);
+
+    void sliderEndChanged(int value);
+
+    void updateStatistics();
+
+    void updateSkyCoverage();
+
+    void updateUVCoverage();
+
+    void updateAll();
+
+private:
+    QString nameA_;
+    QString nameB_;
+    QDateTime refStart_;
+    QDateTime refEnd_;
+
+    QStringList staNames_;
+    QStringList srcNames_;
+    QStringList blNames_;
+    QHash<QString, int> sta2idx_;
+    QHash<QString, int> src2idx_;
+    QHash<QString, int> bl2idx_;
+    QVector<QPair<int, int>> bl2sta_;       ///< merged station indices of each merged baseline
+
+    QVector<ComparedScan> scans_;           ///< merged scans of both schedules sorted by start time
+    int maxScanDuration_ = 0;               ///< longest scan, used to bound the search window in scans_
+    QVector<QVector<ComparedPoint>> sky_;   ///< sky coverage points per merged station
+    QVector<QVector<ComparedPoint>> uv_;    ///< uv points per merged source
+
+    QSlider *slider_start;
+    QSlider *slider_end;
+    QLabel *label_start;
+    QLabel *label_end;
+    QTabWidget *tabs;
+
+    QComboBox *comboBox_statistics_type;
+    QComboBox *comboBox_statistics_category;
+    QChartView *barView;
+    QChartView *pieView;
+
+    QComboBox *comboBox_skyCoverage;
+    QChartView *skyView;
+
+    QComboBox *comboBox_uv;
+    QChartView *uvView;
+
+    int registerName(const QString &name, QStringList &names, QHash<QString, int> &lookup);
+
+    void mergeSchedules(const VieVS::Scheduler &scheduleA, int offsetA, double mjdA,
+                        const VieVS::Scheduler &scheduleB, int offsetB, double mjdB);
+
+    void addScan(const VieVS::Scheduler &schedule, const VieVS::Scan &scan, int schedIdx, int offset, double mjdStart);
+
+    void setupLayout();
+
+    QPair<int, int> scanRange(int start, int end) const;
+
+    static bool inWindow(int s, int e, int start, int end){
+        return (s >= start && s <= end) || (e >= start && e <= end) || (s <= start && e >= end);
+    }
+};
+
+#endif // VIESCHEDPP_COMPARATOR_H